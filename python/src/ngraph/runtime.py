@@ -19,7 +19,8 @@ from typing import Dict, List, Union
 
 import numpy as np
 
-from ngraph.impl import Function, Node, Shape, serialize, util
+from ngraph.impl import Function, Node, Shape, Type, serialize, util
+from ngraph.impl.op import Parameter
 from ngraph.impl.runtime import Backend, Executable, Tensor
 from ngraph.utils.types import get_dtype, NumericData
 from ngraph.exceptions import UserInputError
@@ -64,7 +65,13 @@ class Runtime:
 
 
 class Computation(object):
-    """ngraph callable computation object."""
+    """ngraph callable computation object.
+
+    On backends whose tensors live in host memory, input arrays are handed to the backend in
+    place when they already have the parameter's dtype and a C-contiguous layout, and results
+    are written straight into the returned arrays. Other backends copy the values in and out
+    of tensors allocated by the backend.
+    """
 
     def __init__(self, runtime, ng_function):
         # type: (Runtime, Function) -> None
@@ -74,17 +81,22 @@ class Computation(object):
         self.results = ng_function.get_results()
         self.handle = self.runtime.backend.compile(self.function)
 
-        self.tensor_views = []  # type: List[Tensor]
-        for parameter in self.parameters:
-            shape = parameter.get_shape()
-            element_type = parameter.get_element_type()
-            self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
+        # Only tensors in host memory can wrap numpy arrays, other backends copy the values
+        # through tensors of their own
+        self.host_memory = self.runtime.backend.create_tensor(Type.f32, Shape([])).is_host
 
+        self.tensor_views = []  # type: List[Tensor]
         self.result_views = []  # type: List[Tensor]
-        for result in self.results:
-            shape = result.get_shape()
-            element_type = result.get_element_type()
-            self.result_views.append(runtime.backend.create_tensor(element_type, shape))
+        if not self.host_memory:
+            for parameter in self.parameters:
+                shape = parameter.get_shape()
+                element_type = parameter.get_element_type()
+                self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
+
+            for result in self.results:
+                shape = result.get_shape()
+                element_type = result.get_element_type()
+                self.result_views.append(runtime.backend.create_tensor(element_type, shape))
 
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
@@ -92,19 +104,23 @@ class Computation(object):
 
     def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
         """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
+        if not self.host_memory:
+            return self._call_with_copies(*input_values)
 
-        self.handle.call(self.result_views, self.tensor_views)
+        input_tensors = []  # type: List[Tensor]
+        for parameter, value in zip(self.parameters, input_values):
+            input_tensors.append(self._create_input_tensor(parameter, value))
 
         results = []
-        for result_view in self.result_views:
-            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
-            Computation._read_tensor_view_to_ndarray(result_view, result)
-            results.append(result)
+        result_tensors = []  # type: List[Tensor]
+        for result in self.results:
+            element_type = result.get_element_type()
+            shape = result.get_shape()
+            array = np.empty(list(shape), dtype=get_dtype(element_type))
+            results.append(array)
+            result_tensors.append(self.runtime.backend.create_tensor(element_type, shape, array))
 
+        self.handle.call(result_tensors, input_tensors)
         return results
 
     def serialize(self, indent=0):  # type: (int) -> str
@@ -115,24 +131,59 @@ class Computation(object):
         """
         return serialize(self.function, indent)
 
-    @staticmethod
-    def _get_buffer_size(element_type, element_count):  # type: (Tensor, int) -> int
-        return int((element_type.bitwidth / 8.0) * element_count)
+    def _call_with_copies(self, *input_values):  # type: (*NumericData) -> List[NumericData]
+        """Run computation on backend tensors, copying the values in and out of them."""
+        for tensor_view, value in zip(self.tensor_views, input_values):
+            Computation._write_ndarray_to_tensor_view(value, tensor_view)
+
+        self.handle.call(self.result_views, self.tensor_views)
+
+        results = []
+        for result_view in self.result_views:
+            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
+            Computation._read_tensor_view_to_ndarray(result_view, result)
+            results.append(result)
+
+        return results
+
+    def _create_input_tensor(self, parameter, value):
+        # type: (Parameter, NumericData) -> Tensor
+        """Return a tensor for a parameter that uses the memory of value where possible."""
+        element_type = parameter.get_element_type()
+        shape = parameter.get_shape()
+        value = Computation._convert_ndarray(value, shape, element_type)
+        # Copies only when the array is strided, e.g. a slice or a broadcast scalar
+        value = np.ascontiguousarray(value)
+        return self.runtime.backend.create_tensor(element_type, shape, value)
 
     @staticmethod
-    def _write_ndarray_to_tensor_view(value, tensor_view):
-        # type: (np.ndarray, Tensor) -> None
-        tensor_view_dtype = get_dtype(tensor_view.element_type)
-        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
-            raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
-                                 list(value.shape), list(tensor_view.shape))
-        if value.dtype != tensor_view_dtype:
+    def _convert_ndarray(value, shape, element_type):
+        # type: (NumericData, Shape, Type) -> np.ndarray
+        """Return value as an array of the given shape and element type."""
+        dtype = get_dtype(element_type)
+        if not isinstance(value, np.ndarray):
+            value = np.array(value)
+        if list(shape) != list(value.shape):
+            if len(value.shape) > 0:
+                raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
+                                     list(value.shape), list(shape))
+            value = np.broadcast_to(value, list(shape))
+        if value.dtype != dtype:
             log.warning(
                 'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
                 value.dtype,
-                tensor_view.element_type)
-            value = value.astype(tensor_view_dtype)
+                element_type)
+            value = value.astype(dtype)
+        return value
 
+    @staticmethod
+    def _get_buffer_size(element_type, element_count):  # type: (Type, int) -> int
+        return int((element_type.bitwidth / 8.0) * element_count)
+
+    @staticmethod
+    def _write_ndarray_to_tensor_view(value, tensor_view):
+        # type: (NumericData, Tensor) -> None
+        value = Computation._convert_ndarray(value, tensor_view.shape, tensor_view.element_type)
         buffer_size = Computation._get_buffer_size(
             tensor_view.element_type, tensor_view.element_count)
 
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -36,6 +37,26 @@ static std::shared_ptr<ngraph::runtime::Backend> create(const std::string& type)
     return ngraph::runtime::Backend::create(type, must_support_dynamic);
 }
 
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_from_array(ngraph::runtime::Backend* self,
+                             const ngraph::element::Type& element_type,
+                             const ngraph::Shape& shape,
+                             py::array array)
+{
+    if (!(array.flags() & py::array::c_style))
+    {
+        throw std::invalid_argument("Tensor memory must be a C-contiguous array");
+    }
+    py::buffer_info info = array.request();
+    size_t byte_size = ngraph::shape_size(shape) * element_type.size();
+    if (static_cast<size_t>(info.size * info.itemsize) != byte_size)
+    {
+        throw std::invalid_argument("Array has " + std::to_string(info.size * info.itemsize) +
+                                    " bytes, the tensor needs " + std::to_string(byte_size));
+    }
+    return self->create_tensor(element_type, shape, info.ptr);
+}
+
 void regclass_pyngraph_runtime_Backend(py::module m)
 {
     py::class_<ngraph::runtime::Backend, std::shared_ptr<ngraph::runtime::Backend>> backend(
@@ -47,6 +68,11 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // The tensor uses the array's memory, so it keeps the array alive
+    backend.def("create_tensor",
+                &create_tensor_from_array,
+                py::keep_alive<0, 4>(),
+                "Create a tensor that uses the memory of a C-contiguous numpy array");
     backend.def("compile", &compile);
     backend.def("set_config", &ngraph::runtime::Backend::set_config);
 }
@@ -28,11 +28,14 @@ void regclass_pyngraph_runtime_Executable(py::module m)
     py::class_<ngraph::runtime::Executable, std::shared_ptr<ngraph::runtime::Executable>>
         executable(m, "Executable");
     executable.doc() = "ngraph.impl.runtime.Executable wraps ngraph::runtime::Executable";
+    // Other Python threads can run, e.g. to start inferences of their own, while this one waits
+    // for the backend
     executable.def("call",
                    (bool (ngraph::runtime::Executable::*)(
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                       ngraph::runtime::Executable::call);
+                       ngraph::runtime::Executable::call,
+                   py::call_guard<py::gil_scoped_release>());
     executable.def(
         "get_performance_data",
         (std::vector<ngraph::runtime::PerformanceCounter>(ngraph::runtime::Executable::*)()) &
@@ -18,6 +18,7 @@
 #include <pybind11/stl.h>
 
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/tensor.hpp"
 
@@ -33,13 +34,66 @@ static void write_(ngraph::runtime::Tensor* self, void* p, size_t n)
     self->write(p, n);
 }
 
+static std::string buffer_format(const ngraph::element::Type& type)
+{
+    switch (type)
+    {
+    case ngraph::element::Type_t::boolean: return py::format_descriptor<bool>::format();
+    case ngraph::element::Type_t::f32: return py::format_descriptor<float>::format();
+    case ngraph::element::Type_t::f64: return py::format_descriptor<double>::format();
+    case ngraph::element::Type_t::i8: return py::format_descriptor<int8_t>::format();
+    case ngraph::element::Type_t::i16: return py::format_descriptor<int16_t>::format();
+    case ngraph::element::Type_t::i32: return py::format_descriptor<int32_t>::format();
+    case ngraph::element::Type_t::i64: return py::format_descriptor<int64_t>::format();
+    case ngraph::element::Type_t::u8: return py::format_descriptor<uint8_t>::format();
+    case ngraph::element::Type_t::u16: return py::format_descriptor<uint16_t>::format();
+    case ngraph::element::Type_t::u32: return py::format_descriptor<uint32_t>::format();
+    case ngraph::element::Type_t::u64: return py::format_descriptor<uint64_t>::format();
+    case ngraph::element::Type_t::f16: return "e";
+    case ngraph::element::Type_t::bf16:
+    case ngraph::element::Type_t::u1:
+    case ngraph::element::Type_t::undefined:
+    case ngraph::element::Type_t::dynamic: break;
+    }
+    throw std::invalid_argument("Element type " + type.get_type_name() + " has no buffer format");
+}
+
+// Host tensors expose their memory, so numpy.asarray(tensor) reads and writes it in place
+static py::buffer_info get_buffer(ngraph::runtime::Tensor& self)
+{
+    auto host_tensor = dynamic_cast<ngraph::runtime::HostTensor*>(&self);
+    if (!host_tensor)
+    {
+        throw std::invalid_argument("Only host tensors expose their memory, use read instead");
+    }
+    const ngraph::Shape& shape = self.get_shape();
+    py::ssize_t element_size = self.get_element_type().size();
+    std::vector<py::ssize_t> strides(shape.size());
+    py::ssize_t stride = element_size;
+    for (size_t i = shape.size(); i-- > 0;)
+    {
+        strides[i] = stride;
+        stride *= shape[i];
+    }
+    return py::buffer_info(host_tensor->get_data_ptr(),
+                           element_size,
+                           buffer_format(self.get_element_type()),
+                           shape.size(),
+                           std::vector<py::ssize_t>(shape.begin(), shape.end()),
+                           strides);
+}
+
 void regclass_pyngraph_runtime_Tensor(py::module m)
 {
-    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(m,
-                                                                                         "Tensor");
+    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(
+        m, "Tensor", py::buffer_protocol());
     tensor.doc() = "ngraph.impl.runtime.Tensor wraps ngraph::runtime::Tensor";
     tensor.def("write", &write_);
     tensor.def("read", &read_);
+    tensor.def_buffer(&get_buffer);
+    tensor.def_property_readonly("is_host", [](ngraph::runtime::Tensor& self) {
+        return dynamic_cast<ngraph::runtime::HostTensor*>(&self) != nullptr;
+    });
 
     tensor.def_property_readonly("shape", &ngraph::runtime::Tensor::get_shape);
     tensor.def_property_readonly("element_count", &ngraph::runtime::Tensor::get_element_count);
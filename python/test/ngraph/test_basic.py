@@ -16,9 +16,11 @@
 import numpy as np
 import pytest
 import json
+import threading
 
 import ngraph as ng
 from ngraph.exceptions import UserInputError
+from ngraph.impl import Shape, Type, util
 
 import test
 from test.ngraph.util import get_runtime, run_op_node
@@ -217,3 +219,47 @@ def test_backend_config():
     dummy_config = {'dummy_option': 'dummy_value'}
     # Expect no throw
     ng.runtime(backend_name=test.BACKEND_NAME).set_config(dummy_config)
+
+
+def test_tensor_shares_array_memory():
+    backend = ng.runtime(backend_name=test.BACKEND_NAME).backend
+    if not backend.create_tensor(Type.f32, Shape([2, 2])).is_host:
+        pytest.skip('Backend tensors are not in host memory')
+    array = np.zeros([2, 2], dtype=np.float32)
+    tensor = backend.create_tensor(Type.f32, Shape([2, 2]), array)
+
+    tensor.write(util.numpy_to_c(np.array([[1, 2], [3, 4]], dtype=np.float32)), 16)
+    assert np.array_equal(array, [[1, 2], [3, 4]])
+
+    # Host tensors expose their memory through the buffer protocol
+    view = np.asarray(tensor)
+    view[0, 0] = 5
+    assert array[0, 0] == 5
+
+    with pytest.raises(ValueError):
+        backend.create_tensor(Type.f32, Shape([2, 2]), np.zeros([3], dtype=np.float32))
+
+
+def test_computation_in_threads():
+    A = ng.parameter(shape=[16], name='A', dtype=np.float32)
+    B = ng.parameter(shape=[16], name='B', dtype=np.float32)
+    computation = ng.runtime(backend_name=test.BACKEND_NAME).computation(A * B + A, A, B)
+
+    # The GIL is released while the backend runs, so the calls can overlap
+    results = {}
+
+    def run(index):
+        value_a = np.full([16], index, dtype=np.float32)
+        value_b = np.arange(16, dtype=np.float32)
+        for _ in range(50):
+            results[index] = computation(value_a, value_b)[0]
+
+    threads = [threading.Thread(target=run, args=(index,)) for index in range(4)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for index in range(4):
+        expected = index * np.arange(16, dtype=np.float32) + index
+        assert np.allclose(results[index], expected)
@@ -14,10 +14,24 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
 #include <iostream>
-#include <map>
+#include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
+#if defined(__x86_64__) || defined(_M_X64)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
 
 #include "chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
@@ -26,96 +40,603 @@
 using namespace std;
 using namespace ngraph;
 
-static bool read_tracing_env_var()
+namespace
 {
-    static const bool is_enabled = getenv_bool("NGRAPH_ENABLE_TRACING");
+    uint64_t get_ticks()
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+#else
+        return chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
 
-    return is_enabled;
-}
+    // One event as stored in a ring buffer. The fields are atomics so that the reader may
+    // race with the owning thread overwriting the slot; torn records are discarded.
+    struct Record
+    {
+        atomic<uint64_t> start;
+        atomic<uint64_t> duration;
+        // name in the low half, category in the high half
+        atomic<uint64_t> ids;
+        atomic<uint32_t> args;
+    };
 
-mutex event::Manager::s_file_mutex;
-bool event::Manager::s_tracing_enabled = read_tracing_env_var();
+    struct RecordValue
+    {
+        uint64_t start;
+        uint64_t duration;
+        uint64_t ids;
+        uint32_t args;
+    };
 
-event::Duration::Duration(const string& name, const string& category, const string& args)
-{
-    if (Manager::is_tracing_enabled())
+    // Single producer ring buffer owned by one thread. When the buffer is full the oldest
+    // records are overwritten and the reader counts them as lost, unless the producer is asked
+    // to wait for the reader.
+    class ThreadBuffer
+    {
+    public:
+        ThreadBuffer(size_t capacity, size_t tid)
+            : m_records(new Record[capacity])
+            , m_mask(capacity - 1)
+            , m_tid(tid)
+        {
+        }
+
+        bool sample(size_t rate)
+        {
+            if (rate <= 1 || ++m_sample_count >= rate)
+            {
+                m_sample_count = 0;
+                return true;
+            }
+            m_skipped.store(m_skipped.load(memory_order_relaxed) + 1, memory_order_relaxed);
+            return false;
+        }
+
+        template <typename WAIT>
+        void push(uint64_t start, uint64_t duration, uint64_t ids, uint32_t args, WAIT wait)
+        {
+            uint64_t head = m_head.load(memory_order_relaxed);
+            while (head - m_tail.load(memory_order_acquire) > m_mask && wait())
+            {
+            }
+            // Announce the slot before touching it so that a concurrent reader can tell
+            // whether what it copied may have been overwritten
+            m_reserved.store(head + 1, memory_order_relaxed);
+            atomic_thread_fence(memory_order_release);
+            Record& record = m_records[head & m_mask];
+            record.start.store(start, memory_order_relaxed);
+            record.duration.store(duration, memory_order_relaxed);
+            record.ids.store(ids, memory_order_relaxed);
+            record.args.store(args, memory_order_relaxed);
+            m_head.store(head + 1, memory_order_release);
+        }
+
+        // Only called with the state mutex held
+        void drain(vector<RecordValue>& values, size_t& lost)
+        {
+            uint64_t capacity = m_mask + 1;
+            uint64_t head = m_head.load(memory_order_acquire);
+            uint64_t tail = m_tail.load(memory_order_relaxed);
+            uint64_t begin = max(tail, head > capacity ? head - capacity : 0);
+            size_t first = values.size();
+            for (uint64_t i = begin; i < head; i++)
+            {
+                const Record& record = m_records[i & m_mask];
+                values.push_back({record.start.load(memory_order_relaxed),
+                                  record.duration.load(memory_order_relaxed),
+                                  record.ids.load(memory_order_relaxed),
+                                  record.args.load(memory_order_relaxed)});
+            }
+            atomic_thread_fence(memory_order_acquire);
+            uint64_t reserved = m_reserved.load(memory_order_relaxed);
+            uint64_t valid = min(head, reserved > capacity ? reserved - capacity : 0);
+            if (valid > begin)
+            {
+                values.erase(values.begin() + first, values.begin() + first + (valid - begin));
+                begin = valid;
+            }
+            lost += begin - tail;
+            m_tail.store(head, memory_order_release);
+        }
+
+        size_t get_recorded() const { return m_head.load(memory_order_relaxed); }
+        size_t get_skipped() const { return m_skipped.load(memory_order_relaxed); }
+        size_t get_tid() const { return m_tid; }
+
+    private:
+        unique_ptr<Record[]> m_records;
+        uint64_t m_mask;
+        atomic<uint64_t> m_head{0};
+        atomic<uint64_t> m_reserved{0};
+        atomic<uint64_t> m_skipped{0};
+        size_t m_sample_count{0};
+        atomic<uint64_t> m_tail{0};
+        size_t m_tid;
+    };
+
+    struct RetiredRecord
+    {
+        size_t tid;
+        RecordValue value;
+    };
+
+    event::Manager::Mode read_tracing_mode()
     {
-        m_start = Manager::get_current_microseconds();
-        m_stop = 0;
-        m_name = name;
-        m_category = category;
-        m_args = args;
+        string mode = getenv_string("NGRAPH_TRACING_MODE");
+        if (mode == "full")
+        {
+            return event::Manager::Mode::Full;
+        }
+        else if (mode == "sampled")
+        {
+            return event::Manager::Mode::Sampled;
+        }
+        else if (mode == "always_on")
+        {
+            return event::Manager::Mode::AlwaysOn;
+        }
+        else if (!mode.empty() && mode != "off")
+        {
+            NGRAPH_WARN << "Unknown NGRAPH_TRACING_MODE '" << mode << "', tracing is disabled";
+        }
+        return getenv_bool("NGRAPH_ENABLE_TRACING") ? event::Manager::Mode::Full
+                                                     : event::Manager::Mode::Disabled;
     }
+
 }
 
-void event::Duration::stop()
+// Everything Duration events share. Created on first use and destroyed at exit, which writes
+// out whatever is still buffered.
+class event::Recorder
 {
-    if (Manager::is_tracing_enabled())
+public:
+    static Recorder& get()
     {
-        m_stop = Manager::get_current_microseconds();
+        static Recorder s_recorder;
+        return s_recorder;
     }
-}
 
-void event::Duration::write()
-{
-    if (Manager::is_tracing_enabled())
+    ~Recorder()
     {
-        size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
+        // Threads still recording must not wait for a flusher that is gone
+        m_wait_when_full = false;
+        stop_flusher();
+        close();
+    }
 
-        lock_guard<mutex> lock(Manager::get_mutex());
+    ThreadBuffer* get_thread_buffer()
+    {
+        // Hands the buffer back when its thread exits
+        struct Holder
+        {
+            ~Holder()
+            {
+                if (buffer)
+                {
+                    Recorder::get().retire(buffer);
+                }
+            }
+            unique_ptr<ThreadBuffer> buffer;
+        };
+        static thread_local Holder s_holder;
+        if (!s_holder.buffer)
+        {
+            size_t tid = get_tid();
+            s_holder.buffer.reset(new ThreadBuffer(m_buffer_size, tid));
+            lock_guard<mutex> lock(m_mutex);
+            m_buffers.push_back(s_holder.buffer.get());
+        }
+        return s_holder.buffer.get();
+    }
+
+    // Small sequential ids name the threads of the trace, Duration and Object events use them
+    size_t get_tid()
+    {
+        static thread_local size_t s_tid = allocate_tid();
+        return s_tid;
+    }
 
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
+    // Writes an event of the calling thread, naming the thread first if the file does not
+    // know it yet
+    void write_thread_event(const string& event)
+    {
+        string json;
         {
-            event::Manager::open();
+            lock_guard<mutex> lock(m_mutex);
+            append_thread_name(json, get_tid());
         }
-        else
+        json += event;
+        event::Manager::write_event(json);
+    }
+
+    size_t get_sample_rate() const { return m_sample_rate.load(memory_order_relaxed); }
+    event::Manager::Mode get_mode()
+    {
+        lock_guard<mutex> lock(m_mutex);
+        return m_mode;
+    }
+
+    void record(uint64_t start, uint64_t duration, uint64_t ids, uint32_t args)
+    {
+        // With a flusher running nothing is lost: a thread whose buffer is full wakes the
+        // flusher and waits for it
+        get_thread_buffer()->push(start, duration, ids, args, [this]() {
+            if (!m_wait_when_full.load(memory_order_relaxed))
+            {
+                return false;
+            }
+            m_flusher_cv.notify_one();
+            this_thread::yield();
+            return true;
+        });
+    }
+
+    void set_mode(event::Manager::Mode mode, size_t sample_rate)
+    {
+        m_wait_when_full = false;
+        stop_flusher();
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_mode = mode;
+        }
+        m_sample_rate = mode == event::Manager::Mode::Sampled ? max<size_t>(sample_rate, 1)
+                                                               : 1;
+        event::Manager::s_tracing_enabled = mode != event::Manager::Mode::Disabled;
+        if (mode == event::Manager::Mode::Full || mode == event::Manager::Mode::Sampled)
         {
-            str += ",\n";
+            start_flusher();
+            m_wait_when_full = true;
         }
+    }
 
-        str +=
-            R"({"name":")" + m_name + R"(","cat":")" + m_category + R"(","ph":"X","pid":)" +
-            Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id() +
-            R"(,"ts":)" + to_string(m_start) + R"(,"dur":)" + to_string(stop_time - m_start);
-        if (!m_args.empty())
+    uint32_t intern(const string& name)
+    {
+        static thread_local unordered_map<string, uint32_t> s_cache;
+        auto it = s_cache.find(name);
+        if (it != s_cache.end())
         {
-            str += R"(,"args":)" + m_args;
+            return it->second;
         }
-        str += "}";
-        out << str;
+        uint32_t id;
+        {
+            lock_guard<mutex> lock(m_names_mutex);
+            auto inserted = m_name_ids.insert({name, static_cast<uint32_t>(m_names.size())});
+            if (inserted.second)
+            {
+                m_names.push_back(name);
+            }
+            id = inserted.first->second;
+        }
+        s_cache.insert({name, id});
+        return id;
     }
-}
 
-event::Object::Object(const string& name, const string& args)
-    : m_name{name}
-    , m_id{static_cast<size_t>(chrono::high_resolution_clock::now().time_since_epoch().count())}
+    // Converts everything buffered so far to JSON and appends it to the trace file
+    void flush()
+    {
+        lock_guard<mutex> lock(m_mutex);
+        flush_buffers();
+    }
+
+    // Flushes and terminates the trace file. Threads are named again in the next file.
+    void close()
+    {
+        lock_guard<mutex> lock(m_mutex);
+        flush_buffers();
+        {
+            lock_guard<mutex> file_lock(event::Manager::get_mutex());
+            ofstream& out = event::Manager::get_output_stream();
+            if (out.is_open())
+            {
+                out << "\n]\n";
+                out.close();
+            }
+        }
+        m_named_threads.clear();
+    }
+
+    // Moves the records of a finished thread out of its ring buffer so that the buffer is
+    // freed right away. Without a flusher to pick them up only the latest m_buffer_size of
+    // these records are kept.
+    void retire(unique_ptr<ThreadBuffer>& buffer)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        vector<RecordValue> values;
+        buffer->drain(values, m_lost);
+        for (const RecordValue& value : values)
+        {
+            m_retired_records.push_back({buffer->get_tid(), value});
+        }
+        if (!m_wait_when_full)
+        {
+            while (m_retired_records.size() > m_buffer_size)
+            {
+                m_retired_records.pop_front();
+                m_lost++;
+            }
+        }
+        m_retired_recorded += buffer->get_recorded();
+        m_retired_skipped += buffer->get_skipped();
+        m_buffers.erase(find(m_buffers.begin(), m_buffers.end(), buffer.get()));
+        buffer.reset();
+    }
+
+    event::Manager::Statistics get_statistics()
+    {
+        lock_guard<mutex> lock(m_mutex);
+        event::Manager::Statistics statistics;
+        statistics.recorded = m_retired_recorded;
+        statistics.skipped = m_retired_skipped;
+        for (auto& buffer : m_buffers)
+        {
+            statistics.recorded += buffer->get_recorded();
+            statistics.skipped += buffer->get_skipped();
+        }
+        statistics.lost = m_lost;
+        statistics.written = m_written;
+        return statistics;
+    }
+
+private:
+    Recorder()
+        : m_buffer_size(64)
+        , m_start_ticks(get_ticks())
+        , m_start_us(event::Manager::get_current_microseconds())
+    {
+        // Construct the stream first so that it is still there when the destructor runs
+        event::Manager::get_output_stream();
+        // Round up to a power of two so a slot is found with a mask
+        size_t size = max(getenv_int("NGRAPH_TRACING_BUFFER_SIZE", 1 << 15), 64);
+        while (m_buffer_size < size)
+        {
+            m_buffer_size <<= 1;
+        }
+        m_flush_interval =
+            chrono::milliseconds(max(getenv_int("NGRAPH_TRACING_FLUSH_INTERVAL", 100), 1));
+        set_mode(read_tracing_mode(), max(getenv_int("NGRAPH_TRACING_SAMPLE_RATE", 100), 1));
+    }
+
+    size_t allocate_tid()
+    {
+        stringstream ss;
+        ss << this_thread::get_id();
+        lock_guard<mutex> lock(m_mutex);
+        size_t tid = m_thread_names.size();
+        m_thread_names.push_back(ss.str());
+        return tid;
+    }
+
+    // Only called with m_mutex held
+    void append_thread_name(string& json, size_t tid)
+    {
+        if (m_named_threads.insert(tid).second)
+        {
+            json += R"({"name":"thread_name","ph":"M","pid":)" +
+                    event::Manager::get_process_id() + R"(,"tid":)" + to_string(tid) +
+                    R"(,"args":{"name":")" + m_thread_names[tid] + R"("}},)" + "\n";
+        }
+    }
+
+    // Only called with m_mutex held
+    void flush_buffers()
+    {
+        vector<RecordValue> values;
+        string json;
+        double ticks_per_us = calibrate();
+        {
+            lock_guard<mutex> lock(m_names_mutex);
+            for (const RetiredRecord& record : m_retired_records)
+            {
+                append_thread_name(json, record.tid);
+                append_json(json, record.value, record.tid, ticks_per_us);
+            }
+            m_written += m_retired_records.size();
+            m_retired_records.clear();
+            for (ThreadBuffer* buffer : m_buffers)
+            {
+                values.clear();
+                buffer->drain(values, m_lost);
+                if (!values.empty())
+                {
+                    append_thread_name(json, buffer->get_tid());
+                }
+                for (const RecordValue& value : values)
+                {
+                    append_json(json, value, buffer->get_tid(), ticks_per_us);
+                }
+                m_written += values.size();
+            }
+        }
+        if (!json.empty())
+        {
+            // write_event adds the separator in front of the first event
+            json.resize(json.size() - 2);
+            event::Manager::write_event(json);
+        }
+    }
+
+    double calibrate()
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+        size_t elapsed_us = event::Manager::get_current_microseconds() - m_start_us;
+        if (elapsed_us < 10000)
+        {
+            // Too short an interval gives a poor tick rate estimate
+            this_thread::sleep_for(chrono::microseconds(10000 - elapsed_us));
+        }
+        uint64_t ticks = get_ticks();
+        elapsed_us = event::Manager::get_current_microseconds() - m_start_us;
+        return static_cast<double>(ticks - m_start_ticks) / elapsed_us;
+#else
+        using ticks_per_us = ratio_divide<micro, chrono::steady_clock::period>;
+        return static_cast<double>(ticks_per_us::num) / ticks_per_us::den;
+#endif
+    }
+
+    // Only called with m_names_mutex held
+    void append_json(string& json, const RecordValue& value, size_t tid, double ticks_per_us)
+    {
+        // Events get sub-microsecond timestamps, chrome://tracing accepts fractions. The
+        // offset is added in nanoseconds since a double cannot hold them since the epoch.
+        uint64_t start_ns =
+            m_start_us * 1000 +
+            static_cast<uint64_t>((value.start - m_start_ticks) * 1000 / ticks_per_us);
+        char fields[128];
+        snprintf(fields,
+                 sizeof(fields),
+                 R"(,"tid":%llu,"ts":%llu.%03u,"dur":%.3f)",
+                 static_cast<unsigned long long>(tid),
+                 static_cast<unsigned long long>(start_ns / 1000),
+                 static_cast<unsigned>(start_ns % 1000),
+                 value.duration / ticks_per_us);
+        json.append(R"({"name":")");
+        json.append(m_names[value.ids & 0xffffffff]);
+        json.append(R"(","cat":")");
+        json.append(m_names[value.ids >> 32]);
+        json.append(R"(","ph":"X","pid":)");
+        json.append(event::Manager::get_process_id());
+        json.append(fields);
+        if (value.args != 0)
+        {
+            json.append(R"(,"args":)");
+            json.append(m_names[value.args]);
+        }
+        json.append("},\n");
+    }
+
+    void start_flusher()
+    {
+        m_stop_flusher = false;
+        m_flusher = thread([this]() {
+            unique_lock<mutex> lock(m_flusher_mutex);
+            while (!m_stop_flusher)
+            {
+                m_flusher_cv.wait_for(lock, m_flush_interval);
+                lock.unlock();
+                flush();
+                lock.lock();
+            }
+        });
+    }
+
+    void stop_flusher()
+    {
+        if (m_flusher.joinable())
+        {
+            {
+                lock_guard<mutex> lock(m_flusher_mutex);
+                m_stop_flusher = true;
+            }
+            m_flusher_cv.notify_one();
+            m_flusher.join();
+        }
+    }
+
+    mutex m_mutex;
+    event::Manager::Mode m_mode{event::Manager::Mode::Disabled};
+    atomic<size_t> m_sample_rate{1};
+    atomic<bool> m_wait_when_full{false};
+    size_t m_buffer_size;
+    // Buffers of the running threads, each owned by its thread
+    vector<ThreadBuffer*> m_buffers;
+    deque<RetiredRecord> m_retired_records;
+    vector<string> m_thread_names;
+    set<size_t> m_named_threads;
+    size_t m_retired_recorded{0};
+    size_t m_retired_skipped{0};
+    size_t m_lost{0};
+    size_t m_written{0};
+    uint64_t m_start_ticks;
+    size_t m_start_us;
+
+    // Name 0 is the empty string, so args id 0 means no args
+    mutex m_names_mutex;
+    unordered_map<string, uint32_t> m_name_ids{{"", 0}};
+    vector<string> m_names{""};
+
+    thread m_flusher;
+    mutex m_flusher_mutex;
+    condition_variable m_flusher_cv;
+    bool m_stop_flusher{false};
+    chrono::milliseconds m_flush_interval;
+};
+
+mutex event::Manager::s_file_mutex;
+bool event::Manager::s_tracing_enabled = false;
+
+// Reads the environment and starts the flusher before main() if tracing is requested
+static event::Recorder& s_recorder = event::Recorder::get();
+
+event::Duration::Duration(const string& name, const string& category, const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
+        Recorder& recorder = Recorder::get();
+        if (recorder.get_thread_buffer()->sample(recorder.get_sample_rate()))
         {
-            event::Manager::open();
+            m_name = recorder.intern(name);
+            m_category = recorder.intern(category);
+            m_args = args.empty() ? 0 : recorder.intern(args);
+            m_active = true;
+            m_start = get_ticks();
         }
-        else
+    }
+}
+
+event::Duration::Duration(uint32_t name, uint32_t category)
+{
+    if (Manager::is_tracing_enabled())
+    {
+        Recorder& recorder = Recorder::get();
+        if (recorder.get_thread_buffer()->sample(recorder.get_sample_rate()))
         {
-            str += ",\n";
+            m_name = name;
+            m_category = category;
+            m_active = true;
+            m_start = get_ticks();
         }
-        str += R"({"name":")" + m_name + R"(","ph":"N","id":")" + to_string(m_id) +
-               R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-               R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
+    }
+}
+
+void event::Duration::stop()
+{
+    if (m_active && m_stop == 0)
+    {
+        m_stop = get_ticks();
+    }
+}
+
+void event::Duration::write()
+{
+    if (m_active)
+    {
+        uint64_t stop_time = (m_stop != 0 ? m_stop : get_ticks());
+        Recorder::get().record(
+            m_start, stop_time - m_start, m_name | static_cast<uint64_t>(m_category) << 32, m_args);
+        m_active = false;
+    }
+}
+
+event::Object::Object(const string& name, const string& args)
+    : m_name{name}
+    , m_id{static_cast<size_t>(chrono::high_resolution_clock::now().time_since_epoch().count())}
+{
+    if (Manager::is_tracing_enabled())
+    {
+        string str = R"({"name":")" + m_name + R"(","ph":"N","id":")" + to_string(m_id) +
+                     R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
+                     R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" +
+                     Manager::get_thread_id();
         if (!args.empty())
         {
             str += R"(,"args":)" + args;
         }
         str += "}";
+        Recorder::get().write_thread_event(str);
 
-        write_snapshot(out, args);
+        snapshot(args);
     }
 }
 
@@ -123,18 +644,9 @@ void event::Object::snapshot(const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        write_snapshot(out, args);
+        stringstream ss;
+        write_snapshot(ss, args);
+        Recorder::get().write_thread_event(ss.str());
     }
 }
 
@@ -155,42 +667,56 @@ void event::Object::destroy()
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
         string str = R"({"name":")" + m_name + R"(","ph":"D","id":")" + to_string(m_id) +
                      R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
                      R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" +
                      Manager::get_thread_id() + "}";
+        Recorder::get().write_thread_event(str);
     }
 }
 
+// Whether the trace file holds an event already, guarded by the file mutex
+static bool s_separate_events = false;
+
 void event::Manager::open(const string& path)
 {
+    lock_guard<mutex> lock(get_mutex());
     ofstream& out = get_output_stream();
     if (out.is_open() == false)
     {
         out.open(path, ios_base::trunc);
         out << "[\n";
+        s_separate_events = false;
     }
 }
 
 void event::Manager::close()
 {
+    Recorder::get().close();
+}
+
+void event::Manager::flush()
+{
+    Recorder::get().flush();
+    lock_guard<mutex> lock(get_mutex());
+    get_output_stream().flush();
+}
+
+void event::Manager::write_event(const string& event)
+{
+    lock_guard<mutex> lock(get_mutex());
     ofstream& out = get_output_stream();
-    if (out.is_open())
+    if (out.is_open() == false)
     {
-        out << "\n]\n";
-        out.close();
+        out.open("runtime_event_trace.json", ios_base::trunc);
+        out << "[\n";
     }
+    else if (s_separate_events)
+    {
+        out << ",\n";
+    }
+    out << event;
+    s_separate_events = true;
 }
 
 ofstream& event::Manager::get_output_stream()
@@ -207,12 +733,12 @@ const string& event::Manager::get_process_id()
 
 void event::Manager::enable_event_tracing()
 {
-    s_tracing_enabled = true;
+    set_tracing_mode(Mode::Full);
 }
 
 void event::Manager::disable_event_tracing()
 {
-    s_tracing_enabled = false;
+    set_tracing_mode(Mode::Disabled);
 }
 
 bool event::Manager::is_event_tracing_enabled()
@@ -220,22 +746,27 @@ bool event::Manager::is_event_tracing_enabled()
     return s_tracing_enabled;
 }
 
+void event::Manager::set_tracing_mode(Mode mode, size_t sample_rate)
+{
+    Recorder::get().set_mode(mode, sample_rate);
+}
+
+event::Manager::Mode event::Manager::get_tracing_mode()
+{
+    return Recorder::get().get_mode();
+}
+
+event::Manager::Statistics event::Manager::get_statistics()
+{
+    return Recorder::get().get_statistics();
+}
+
+uint32_t event::Manager::intern(const string& name)
+{
+    return Recorder::get().intern(name);
+}
+
 string event::Manager::get_thread_id()
 {
-    thread::id tid = this_thread::get_id();
-    static map<thread::id, string> tid_map;
-    auto it = tid_map.find(tid);
-    string rc;
-    if (it == tid_map.end())
-    {
-        stringstream ss;
-        ss << "\"" << tid << "\"";
-        rc = ss.str();
-        tid_map.insert({tid, rc});
-    }
-    else
-    {
-        rc = it->second;
-    }
-    return rc;
+    return to_string(Recorder::get().get_tid());
 }
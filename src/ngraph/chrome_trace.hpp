@@ -17,6 +17,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -40,6 +41,7 @@ namespace ngraph
         class Duration;
         class Object;
         class Manager;
+        class Recorder;
     }
 }
 
@@ -73,22 +75,65 @@ namespace ngraph
 //
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
+//
+// Duration events do not touch the trace file. Each thread appends fixed size records, holding
+// interned name ids and raw clock ticks, to its own ring buffer without taking a lock. The
+// buffers are converted to JSON by a background thread, by flush() and at shutdown. The
+// recording mode is selected with NGRAPH_TRACING_MODE (full, sampled or always_on) or with
+// set_tracing_mode(); NGRAPH_ENABLE_TRACING selects full. NGRAPH_TRACING_SAMPLE_RATE,
+// NGRAPH_TRACING_BUFFER_SIZE (records per thread) and NGRAPH_TRACING_FLUSH_INTERVAL
+// (milliseconds) tune the recorder.
 
-class ngraph::event::Manager
+class NGRAPH_API ngraph::event::Manager
 {
     friend class Duration;
     friend class Object;
+    friend class Recorder;
 
 public:
+    enum class Mode
+    {
+        /// Nothing is recorded
+        Disabled,
+        /// Every event is recorded and written out by the background flusher
+        Full,
+        /// One in every `sample_rate` events of each thread is recorded
+        Sampled,
+        /// Every event is recorded but only the most recent ones of each running thread,
+        /// and of the threads that finished, are kept. They are written out by flush() and
+        /// at shutdown.
+        AlwaysOn
+    };
+
+    struct Statistics
+    {
+        /// Events appended to the ring buffers
+        size_t recorded{0};
+        /// Events left out by sampling
+        size_t skipped{0};
+        /// Events overwritten before they could be written out
+        size_t lost{0};
+        /// Events written to the trace file
+        size_t written{0};
+    };
+
     static void open(const std::string& path = "runtime_event_trace.json");
     static void close();
+    /// \brief Write the events recorded so far to the trace file
+    static void flush();
     static bool is_tracing_enabled() { return s_tracing_enabled; }
     static void enable_event_tracing();
     static void disable_event_tracing();
     static bool is_event_tracing_enabled();
+    static void set_tracing_mode(Mode mode, size_t sample_rate = 100);
+    static Mode get_tracing_mode();
+    static Statistics get_statistics();
+    /// \brief Returns the id used in event records for `name`
+    static uint32_t intern(const std::string& name);
 
 private:
     static std::ofstream& get_output_stream();
+    static void write_event(const std::string& event);
     static const std::string& get_process_id();
     static size_t get_current_microseconds()
     {
@@ -107,6 +152,8 @@ public:
     explicit Duration(const std::string& name,
                       const std::string& category,
                       const std::string& args = "");
+    /// \brief Start an event named by ids from Manager::intern()
+    Duration(uint32_t name, uint32_t category);
     ~Duration() { write(); }
     /// \brief stop the timer without writing the data to the log file. To write the data
     /// call the `write` method
@@ -121,12 +168,12 @@ public:
     Duration& operator=(Duration const&) = delete;
 
 private:
-    std::string to_json() const;
-    size_t m_start{0};
-    size_t m_stop{0};
-    std::string m_name;
-    std::string m_category;
-    std::string m_args;
+    uint64_t m_start{0};
+    uint64_t m_stop{0};
+    uint32_t m_name{0};
+    uint32_t m_category{0};
+    uint32_t m_args{0};
+    bool m_active{false};
 };
 
 class ngraph::event::Object
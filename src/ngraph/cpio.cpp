@@ -130,11 +130,27 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     write_u32(stream, 0);        // mtime
     write_u16(stream, namesize); // namesize
     write_u32(stream, size);     // filesize
-    stream.write(name.c_str(), namesize + (namesize % 2));
+    stream.write(name.c_str(), namesize);
+    if (namesize % 2)
+    {
+        char ch = 0;
+        stream.write(&ch, 1);
+    }
+}
+
+// Name of the records Writer inserts to align the data of the next record
+static const string s_pad_record_name = ".pad";
+
+// Size of a binary header plus its padded name
+static size_t record_header_size(const string& name)
+{
+    size_t namesize = name.size() + 1;
+    return 26 + namesize + (namesize % 2);
 }
 
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_offset(0)
 {
 }
 
@@ -162,12 +178,14 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_offset = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
+    m_offset = 0;
 }
 
 void cpio::Writer::write(const string& record_name, const void* data, uint32_t size_in_bytes)
@@ -181,6 +199,7 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_offset += record_header_size(record_name) + size_in_bytes + (size_in_bytes % 2);
     }
     else
     {
@@ -188,6 +207,28 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
     }
 }
 
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
+{
+    if (alignment % 2)
+    {
+        throw runtime_error("cpio record alignment must be even");
+    }
+    // Every record starts on an even offset, so an even sized padding record can always move
+    // the next record's data onto the required boundary
+    size_t data_offset = m_offset + record_header_size(record_name);
+    if (data_offset % alignment != 0)
+    {
+        size_t unpadded_offset = data_offset + record_header_size(s_pad_record_name);
+        size_t pad_size = (alignment - unpadded_offset % alignment) % alignment;
+        vector<char> pad(pad_size, 0);
+        write(s_pad_record_name, pad.data(), static_cast<uint32_t>(pad_size));
+    }
+    write(record_name, data, size_in_bytes);
+}
+
 cpio::Reader::Reader()
     : m_stream(nullptr)
 {
@@ -253,8 +294,11 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
                 break;
             }
 
-            size_t offset = m_stream->tellg();
-            m_file_info.emplace_back(file_name, header.filesize, offset);
+            if (file_name != s_pad_record_name)
+            {
+                size_t offset = m_stream->tellg();
+                m_file_info.emplace_back(file_name, header.filesize, offset);
+            }
 
             m_stream->seekg((header.filesize % 2) + header.filesize, ios_base::cur);
         }
@@ -286,10 +330,16 @@ bool cpio::Reader::read(const string& file_name, void* data, size_t size_in_byte
 vector<char> cpio::Reader::read(const FileInfo& info)
 {
     vector<char> buffer(info.get_size());
-    read(info.get_name(), buffer.data(), info.get_size());
+    read(info, buffer.data());
     return buffer;
 }
 
+void cpio::Reader::read(const FileInfo& info, void* data)
+{
+    m_stream->seekg(info.get_offset(), ios_base::beg);
+    m_stream->read(reinterpret_cast<char*>(data), info.get_size());
+}
+
 bool cpio::is_cpio(const string& path)
 {
     ifstream in(path, ios_base::binary | ios_base::in);
@@ -92,9 +92,19 @@ public:
     void open(const std::string& filename);
     void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
 
+    /// \brief Writes a record whose data starts at a multiple of alignment bytes from the
+    ///        start of the archive. Padding records are inserted as needed, Reader does not
+    ///        list them.
+    /// \param alignment Required alignment; must be even
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment);
+
 private:
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    size_t m_offset;
 };
 
 class NGRAPH_API ngraph::cpio::Reader
@@ -111,6 +121,9 @@ public:
     const std::vector<FileInfo>& get_file_info();
     bool read(const std::string& file_name, void* data, size_t size_in_bytes);
     std::vector<char> read(const FileInfo& info);
+    /// \brief Reads the record described by info into data, which must hold info.get_size()
+    ///        bytes
+    void read(const FileInfo& info, void* data);
 
 private:
     std::istream* m_stream;
@@ -50,6 +50,7 @@ descriptor::Input::~Input()
 
 void descriptor::Input::replace_output(Output& new_output)
 {
+    m_node->topology_changed();
     if (m_output != nullptr)
     {
         m_output->remove_input(this);
@@ -76,7 +76,8 @@ string file_util::get_file_ext(const string& s)
 
 string file_util::get_directory(const string& s)
 {
-    string rc = s;
+    // A path without a directory is in the current directory
+    string rc;
     auto pos = s.find_last_of('/');
     if (pos != string::npos)
     {
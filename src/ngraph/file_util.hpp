@@ -36,7 +36,7 @@ namespace ngraph
         NGRAPH_API
         std::string get_file_ext(const std::string& path);
 
-        /// \brief Returns the directory portion of the given path
+        /// \brief Returns the directory portion of the given path, empty if it has none
         /// \param path The path to the output file
         NGRAPH_API
         std::string get_directory(const std::string& path);
@@ -105,8 +105,11 @@ namespace ngraph
                     Tensor tensor = Tensor{initializer_tensor};
                     m_initializers.emplace(initializer_tensor.name(), tensor);
 
-                    // For each initializer, create a Constant node and store in cache
-                    auto ng_constant = tensor.get_ng_constant();
+                    // For each initializer, create a Constant node and store in cache. Values
+                    // stored as raw bytes or in an external file are used in place.
+                    auto data = m_model->get_tensor_data(initializer_tensor);
+                    auto ng_constant =
+                        data ? tensor.get_ng_constant(data) : tensor.get_ng_constant();
                     add_provenance_tag_to_initializer(tensor, ng_constant);
                     m_ng_node_cache.emplace(initializer_tensor.name(), std::move(ng_constant));
                 }
@@ -14,16 +14,50 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdint>
+#include <cstring>
 #include <onnx/onnx_pb.h>
 
 #include "model.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ops_bridge.hpp"
+#include "tensor.hpp"
 
 namespace ngraph
 {
     namespace onnx_import
     {
+        namespace
+        {
+            /// \brief Whether an external data location from a model file stays inside the
+            ///        model's directory: it must be relative and must not contain ".."
+            bool is_contained_location(const std::string& location)
+            {
+                if (location.empty() || location[0] == '/' || location[0] == '\\' ||
+                    location.find(':') != std::string::npos)
+                {
+                    return false;
+                }
+                size_t begin = 0;
+                while (begin <= location.size())
+                {
+                    size_t end = location.find_first_of("/\\", begin);
+                    if (end == std::string::npos)
+                    {
+                        end = location.size();
+                    }
+                    if (location.compare(begin, end - begin, "..") == 0)
+                    {
+                        return false;
+                    }
+                    begin = end + 1;
+                }
+                return true;
+            }
+        }
+
         Model::Model(const onnx::ModelProto& model_proto)
             : m_model_proto{&model_proto}
         {
@@ -45,6 +79,104 @@ namespace ngraph
             }
         }
 
+        Model::Model(const std::shared_ptr<const onnx::ModelProto>& model_proto,
+                     const std::string& model_dir)
+            : Model(*model_proto)
+        {
+            m_shared_model_proto = model_proto;
+            m_model_dir = model_dir;
+        }
+
+        namespace detail
+        {
+            /// \brief Wraps size bytes at data, owned by owner, in a buffer for a Constant. Data
+            ///        that is not aligned to its elements is copied into a buffer of its own.
+            template <typename T>
+            std::shared_ptr<runtime::AlignedBuffer> make_tensor_buffer(
+                const char* data, size_t size, size_t element_size, const std::shared_ptr<T>& owner)
+            {
+                if (reinterpret_cast<std::uintptr_t>(data) % element_size == 0)
+                {
+                    return std::make_shared<runtime::SharedBuffer<T>>(
+                        const_cast<char*>(data), size, owner);
+                }
+                auto buffer = std::make_shared<runtime::AlignedBuffer>(size);
+                std::memcpy(buffer->get_ptr(), data, size);
+                return buffer;
+            }
+        }
+
+        std::shared_ptr<runtime::AlignedBuffer>
+            Model::get_tensor_data(const onnx::TensorProto& tensor)
+        {
+            const Tensor wrapper{tensor};
+            const size_t element_size = wrapper.get_ng_type().size();
+            if (wrapper.has_external_data())
+            {
+                std::string location;
+                size_t offset = 0;
+                size_t length = 0;
+                bool has_length = false;
+                for (const auto& entry : tensor.external_data())
+                {
+                    if (entry.key() == "location")
+                    {
+                        location = entry.value();
+                    }
+                    else if (entry.key() == "offset")
+                    {
+                        offset = std::stoull(entry.value());
+                    }
+                    else if (entry.key() == "length")
+                    {
+                        length = std::stoull(entry.value());
+                        has_length = true;
+                    }
+                }
+                NGRAPH_CHECK(!location.empty(),
+                             "Tensor '",
+                             tensor.name(),
+                             "' has external data without a location");
+                // The location comes from the model file, it must not reach outside the
+                // model's directory
+                NGRAPH_CHECK(is_contained_location(location),
+                             "External data location '",
+                             location,
+                             "' of tensor '",
+                             tensor.name(),
+                             "' must be a relative path without '..'");
+
+                const std::string path = file_util::path_join(m_model_dir, location);
+                std::shared_ptr<runtime::MappedFile>& file = m_external_data_files[path];
+                if (!file)
+                {
+                    file = std::make_shared<runtime::MappedFile>(path);
+                }
+                if (!has_length && offset <= file->size())
+                {
+                    length = file->size() - offset;
+                }
+                NGRAPH_CHECK(offset <= file->size() && length <= file->size() - offset,
+                             "External data of tensor '",
+                             tensor.name(),
+                             "' is outside of ",
+                             path);
+                return detail::make_tensor_buffer(
+                    file->get_ptr() + offset, length, element_size, file);
+            }
+            // raw_data of an unexpected size is left to the copying path, which handles it
+            // as before
+            if (m_shared_model_proto && tensor.has_raw_data() && !tensor.has_segment() &&
+                tensor.raw_data().size() == shape_size(wrapper.get_shape()) * element_size)
+            {
+                return detail::make_tensor_buffer(tensor.raw_data().data(),
+                                                  tensor.raw_data().size(),
+                                                  element_size,
+                                                  m_shared_model_proto);
+            }
+            return nullptr;
+        }
+
         const Operator& Model::get_operator(const std::string& name,
                                             const std::string& domain) const
         {
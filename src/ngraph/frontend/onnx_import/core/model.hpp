@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/mapped_file.hpp"
 #include "operator_set.hpp"
 
 namespace ngraph
@@ -33,6 +37,14 @@ namespace ngraph
             Model() = delete;
             explicit Model(const onnx::ModelProto& model_proto);
 
+            /// \brief Creates a model whose initializers can use the memory of model_proto
+            ///        instead of copying it
+            ///
+            /// \param model_proto The model, kept alive by the Constants that reference it.
+            /// \param model_dir   The directory that external data locations are relative to.
+            Model(const std::shared_ptr<const onnx::ModelProto>& model_proto,
+                  const std::string& model_dir);
+
             Model(const Model&) = default;
             Model(Model&&) = default;
 
@@ -72,9 +84,25 @@ namespace ngraph
             ///
             void enable_opset_domain(const std::string& domain);
 
+            /// \brief      Gets the values of a tensor without copying them.
+            ///
+            /// \note       External data files are memory-mapped once and shared by all of the
+            ///             tensors stored in them. raw_data is only used in place when the model
+            ///             was created from a shared ModelProto.
+            ///
+            /// \param[in]  tensor  A tensor of this model, e.g. an initializer.
+            ///
+            /// \return     A buffer over the tensor's values, or nullptr when the values are
+            ///             not stored as raw bytes that can be used in place.
+            std::shared_ptr<runtime::AlignedBuffer>
+                get_tensor_data(const onnx::TensorProto& tensor);
+
         private:
             const onnx::ModelProto* m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
+            std::shared_ptr<const onnx::ModelProto> m_shared_model_proto;
+            std::string m_model_dir;
+            std::map<std::string, std::shared_ptr<runtime::MappedFile>> m_external_data_files;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Model& model)
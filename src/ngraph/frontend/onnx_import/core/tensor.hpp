@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -484,17 +485,63 @@ namespace ngraph
                 }
             }
 
+            /// \brief Creates a Constant that uses data as its storage instead of copying the
+            ///        tensor's values
+            ///
+            /// \param data The tensor's values, e.g. a buffer over the raw_data of a protobuf
+            ///             that outlives the Constant or over a memory-mapped external data file
+            std::shared_ptr<ngraph::op::Constant>
+                get_ng_constant(const std::shared_ptr<runtime::AlignedBuffer>& data) const
+            {
+                const element::Type& type = get_ng_type();
+                NGRAPH_CHECK(data->size() == shape_size(m_shape) * type.size(),
+                             "Tensor data has ",
+                             data->size(),
+                             " bytes, expected ",
+                             shape_size(m_shape) * type.size());
+                auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+                set_friendly_name(constant);
+                return constant;
+            }
+
+            /// \returns true if the tensor's values are stored in a separate file
+            bool has_external_data() const
+            {
+                return m_tensor_proto->data_location() ==
+                       onnx::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
+            }
+
         private:
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                NGRAPH_CHECK(!has_external_data(),
+                             "Tensor '",
+                             m_tensor_proto->name(),
+                             "' has external data, which needs the model it belongs to");
+                std::shared_ptr<ngraph::op::Constant> constant;
+                const std::string& raw_data = m_tensor_proto->raw_data();
+                if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment() &&
+                    raw_data.size() == shape_size(m_shape) * type.size())
+                {
+                    // Copy the bytes straight into the Constant rather than through a vector
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, static_cast<const void*>(raw_data.data()));
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
+                set_friendly_name(constant);
+                return constant;
+            }
+
+            void set_friendly_name(const std::shared_ptr<ngraph::op::Constant>& constant) const
+            {
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
                 }
-                return constant;
             }
 
             const onnx::TensorProto* m_tensor_proto;
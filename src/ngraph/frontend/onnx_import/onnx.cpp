@@ -22,6 +22,7 @@
 #include "core/graph.hpp"
 #include "core/model.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -50,34 +51,43 @@ namespace ngraph
                 };
 
             } // namespace error
-        }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
-        {
-            onnx::ModelProto model_proto;
-            // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                        const std::string& model_dir)
             {
-                // Rewind to the beginning and clear stream state.
-                stream.clear();
-                stream.seekg(0);
-                google::protobuf::io::IstreamInputStream iistream(&stream);
-                // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                // The initializers of the imported function keep the ModelProto alive and use
+                // its raw_data in place
+                auto model_proto = std::make_shared<onnx::ModelProto>();
+                // Try parsing input as a binary protobuf message
+                if (!model_proto->ParseFromIstream(&stream))
                 {
-                    throw detail::error::stream_parse{stream};
+                    // Rewind to the beginning and clear stream state.
+                    stream.clear();
+                    stream.seekg(0);
+                    google::protobuf::io::IstreamInputStream iistream(&stream);
+                    // Try parsing input as a prototxt message
+                    if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
+                    {
+                        throw error::stream_parse{stream};
+                    }
                 }
-            }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
-            {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                Model model{model_proto, model_dir};
+                Graph graph{model_proto->graph(), model};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
+                {
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
+                }
+                return function;
             }
-            return function;
+        } // namespace detail
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return detail::import_onnx_model(stream, "");
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -87,7 +97,8 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            // External data locations are relative to the directory of the model file
+            return detail::import_onnx_model(ifs, file_util::get_directory(file_path));
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
@@ -62,6 +62,8 @@ namespace ngraph
         /// \note       If stream parsing fails or the ONNX model contains unsupported ops,
         ///             the function throws an ngraph_error exception.
         ///
+        /// \note       External data locations are resolved against the current directory.
+        ///
         /// \param[in]  stream    The input stream (e.g. file stream, memory stream, etc).
         ///
         /// \return     An nGraph function that represents a single output from the created graph.
@@ -74,6 +76,9 @@ namespace ngraph
         /// \note      If file parsing fails or the ONNX model contains unsupported ops,
         ///            the function throws an ngraph_error exception.
         ///
+        /// \note      Initializers stored in external data files are memory-mapped from the
+        ///            files, which are looked up relative to the directory of the model.
+        ///
         /// \param[in] file_path  The path to a file containing the ONNX model
         ///                       (relative or absolute).
         ///
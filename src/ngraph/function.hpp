@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -93,6 +94,10 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the ops in topological order
+        ///
+        /// The order is cached and recomputed only after an input or control dependency edge
+        /// in the graph has changed (see Node::get_topology_version).
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -144,5 +149,11 @@ namespace ngraph
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+
+        void invalidate_ordered_ops();
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_ordered_ops;
+        mutable size_t m_ordered_ops_version{0};
+        mutable bool m_ordered_ops_valid{false};
     };
 }
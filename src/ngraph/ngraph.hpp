@@ -96,5 +96,6 @@ namespace ngraph
 #include "ngraph/shape.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/specialize_function.hpp"
+#include "ngraph/strided_walk.hpp"
 #include "ngraph/type.hpp"
 #include "ngraph/type/element_type.hpp"
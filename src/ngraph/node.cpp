@@ -35,6 +35,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_topology_version(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -194,6 +195,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    topology_changed();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -206,6 +208,10 @@ void Node::set_arguments(const OutputVector& arguments)
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
 {
+    if (m_inputs.size() <= position)
+    {
+        topology_changed();
+    }
     while (m_inputs.size() <= position)
     {
         m_inputs.emplace_back(this, m_inputs.size());
@@ -551,6 +557,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        topology_changed();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -588,6 +595,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            topology_changed();
             m_control_dependencies.erase(it);
         }
     }
@@ -602,6 +610,10 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
 
 void Node::clear_control_dependencies()
 {
+    if (!m_control_dependencies.empty())
+    {
+        topology_changed();
+    }
     for (auto& node : m_control_dependencies)
     {
         auto it = find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this);
@@ -613,6 +625,27 @@ void Node::clear_control_dependencies()
     m_control_dependencies.clear();
 }
 
+size_t Node::get_topology_version()
+{
+    return m_topology_version;
+}
+
+void Node::topology_changed() const
+{
+    // A node can only be reached by a topological sort from a Function's results and parameters
+    // through input and control dependency edges, so a node that is neither of those and has no
+    // users or control dependents is still under construction and cannot invalidate any order.
+    bool may_be_in_graph = is_output() || is_parameter() || !m_control_dependents.empty();
+    for (size_t i = 0; !may_be_in_graph && i < m_outputs.size(); ++i)
+    {
+        may_be_in_graph = !m_outputs[i].get_inputs().empty();
+    }
+    if (may_be_in_graph)
+    {
+        ++m_topology_version;
+    }
+}
+
 void Node::clear_control_dependents()
 {
     while (!m_control_dependents.empty())
@@ -355,6 +355,11 @@ namespace ngraph
         /// This node's control dependencies are replaced by replacement
         void transfer_control_dependents(std::shared_ptr<Node> replacement);
 
+        /// \brief Returns a counter that changes whenever an input or control dependency of a
+        /// node that may belong to a graph changes. Function uses it to decide whether its
+        /// cached topological order is still current.
+        static size_t get_topology_version();
+
         /// Returns the number of outputs from the node.
         size_t get_output_size() const;
 
@@ -576,6 +581,8 @@ namespace ngraph
     private:
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
+        /// Called before this node's inputs or control dependencies change
+        void topology_changed() const;
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
@@ -584,6 +591,7 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_topology_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
@@ -306,6 +307,18 @@ void* op::Constant::allocate_buffer()
     return get_data_ptr_nc();
 }
 
+void* op::Constant::get_data_ptr_nc()
+{
+    if (m_data && m_data.use_count() > 1)
+    {
+        // Copy on write, clones and the buffer's other owners keep the original data
+        auto data = make_shared<runtime::AlignedBuffer>(m_data->size(), host_alignment());
+        memcpy(data->get_ptr(), m_data->get_ptr(), m_data->size());
+        m_data = data;
+    }
+    return m_data ? m_data->get_ptr() : nullptr;
+}
+
 op::Constant::Constant(const element::Type& type, const Shape& shape, const void* data)
     : Constant(type, shape)
 {
@@ -315,11 +328,33 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    NODE_VALIDATION_CHECK(this,
+                          m_data && m_data->size() >= size,
+                          "Buffer of ",
+                          (m_data ? m_data->size() : 0),
+                          " bytes is too small for a constant of type ",
+                          m_element_type,
+                          " and shape ",
+                          m_shape);
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
-    : Constant(other.m_element_type, other.m_shape)
+    : Op()
+    , m_element_type(other.m_element_type)
+    , m_shape(other.m_shape)
+    , m_data(other.m_data)
+    , m_all_elements_bitwise_identical(other.m_all_elements_bitwise_identical)
 {
-    m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
     constructor_validate_and_infer_types();
 }
 
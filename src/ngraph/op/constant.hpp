@@ -89,7 +89,7 @@ namespace ngraph
                 /// \param value A scalar for initializing the uniform tensor constant. The
                 ///               value is broadcast to the specified shape.
                 template <class T,
-                          class = typename std::enable_if<std::is_fundamental<T>::value>::type>
+                          class = typename std::enable_if<std::is_arithmetic<T>::value>::type>
                 Constant(const element::Type& type, Shape shape, T value)
                     : Constant(type, shape)
                 {
@@ -233,6 +233,19 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant that uses an existing buffer as its
+                ///        storage, without copying it
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer holding at least the constant's data, e.g. a
+                ///             runtime::SharedBuffer over a memory-mapped file.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
+                /// \brief Constructs a constant that shares the storage of other. The storage is
+                ///        copied only if one of them is written to.
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -447,7 +460,11 @@ namespace ngraph
                 /// \brief Allocate a buffer and return a pointer to it
                 void* allocate_buffer();
 
-                void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
+                /// \brief Returns a writable pointer to the data.
+                ///
+                /// The storage is shared by every copy of the constant, so it is copied here
+                /// first unless this constant is its only owner.
+                void* get_data_ptr_nc();
                 template <element::Type_t ET>
                 typename element_type_traits<ET>::value_type* get_data_ptr_nc()
                 {
@@ -129,6 +129,10 @@ namespace
             break;
             TYPE_CASE(f64)(arg0, arg1, out, broadcast_spec, pythondiv);
             break;
+            TYPE_CASE(f16)(arg0, arg1, out, broadcast_spec, pythondiv);
+            break;
+            TYPE_CASE(bf16)(arg0, arg1, out, broadcast_spec, pythondiv);
+            break;
         default: rc = false; break;
         }
         return rc;
@@ -101,6 +101,10 @@ namespace
             break;
             TYPE_CASE(f64)(arg0, arg1, out, broadcast_spec);
             break;
+            TYPE_CASE(f16)(arg0, arg1, out, broadcast_spec);
+            break;
+            TYPE_CASE(bf16)(arg0, arg1, out, broadcast_spec);
+            break;
         default: rc = false; break;
         }
         return rc;
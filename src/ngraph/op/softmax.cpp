@@ -174,7 +174,9 @@ namespace
     {
         auto shape = out->get_shape();
         return try_evaluate_softmax<element::Type_t::f32>(arg, out, shape, axes) ||
-               try_evaluate_softmax<element::Type_t::f64>(arg, out, shape, axes);
+               try_evaluate_softmax<element::Type_t::f64>(arg, out, shape, axes) ||
+               try_evaluate_softmax<element::Type_t::f16>(arg, out, shape, axes) ||
+               try_evaluate_softmax<element::Type_t::bf16>(arg, out, shape, axes);
     }
 }
 
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <regex>
 #include <unordered_set>
 #include <vector>
@@ -60,6 +61,11 @@ using namespace ngraph;
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
+//
+// Most matchers are rooted at a concrete op type, so before walking the graph the matchers are
+// bucketed by the type of their pattern root. Each node is then only offered to the matchers
+// rooted at its own type plus those whose root may match anything (Label, Any, etc.). The two
+// lists are merged by registration index so matchers still run in the order they were added.
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
@@ -78,14 +84,43 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+        map<NodeTypeInfo, vector<size_t>> typed_matchers;
+        vector<size_t> untyped_matchers;
+        for (size_t i = 0; i < matchers_to_run.size(); ++i)
+        {
+            if (matchers_to_run[i].root_types.empty())
+            {
+                untyped_matchers.push_back(i);
+            }
+            for (auto& type_info : matchers_to_run[i].root_types)
+            {
+                typed_matchers[type_info].push_back(i);
+            }
+        }
+        static const vector<size_t> no_matchers;
         for (auto node : f->get_ordered_ops())
         {
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            auto it = typed_matchers.find(node->get_type_info());
+            const vector<size_t>& typed = it == typed_matchers.end() ? no_matchers : it->second;
+            auto typed_it = typed.begin();
+            auto untyped_it = untyped_matchers.begin();
+            while (typed_it != typed.end() || untyped_it != untyped_matchers.end())
             {
+                size_t index;
+                if (untyped_it == untyped_matchers.end() ||
+                    (typed_it != typed.end() && *typed_it < *untyped_it))
+                {
+                    index = *typed_it++;
+                }
+                else
+                {
+                    index = *untyped_it++;
+                }
+                auto& closure = matchers_to_run[index];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -149,11 +184,12 @@ bool pass::GraphRewriteBase::is_enabled(const std::string& name) const
 
 void pass::GraphRewriteBase::add_handler(const std::string& name,
                                          function<bool(const std::shared_ptr<Node>&)> handler,
-                                         const PassPropertyMask& property)
+                                         const PassPropertyMask& property,
+                                         const std::set<NodeTypeInfo>& root_types)
 {
     if (is_enabled(name))
     {
-        m_matchers.push_back({name, handler, property});
+        m_matchers.push_back({name, handler, property, root_types});
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -177,7 +213,8 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                     }
                     return false;
                 },
-                property);
+                property,
+                m->get_root_types());
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
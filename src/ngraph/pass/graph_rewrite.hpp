@@ -44,9 +44,11 @@ public:
     /// \param name The name of the handler
     /// \param handler Function responsible for deciding if the graph should be changed and making
     /// the changes. Returns true if changes are made.
+    /// \param root_types The node types the handler can change; empty means any type
     void add_handler(const std::string& name,
                      std::function<bool(const std::shared_ptr<Node>& node)> handler,
-                     const PassPropertyMask& property);
+                     const PassPropertyMask& property,
+                     const std::set<NodeTypeInfo>& root_types = {});
 
 protected:
     GraphRewriteBase()
@@ -65,6 +67,7 @@ protected:
         std::string name;
         std::function<bool(const std::shared_ptr<Node>& node)> handler;
         PassPropertyMask property;
+        std::set<NodeTypeInfo> root_types;
     };
     std::vector<MatchClosure> m_matchers;
 };
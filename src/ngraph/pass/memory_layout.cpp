@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <numeric>
 #include <sstream>
 
 #include "ngraph/log.hpp"
@@ -30,9 +32,12 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 MemoryManager::allocation_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(disable_memory_sharing ? MemoryManager::allocation_scheme::NO_REUSE : scheme)
 {
     if (m_alignment == 0)
     {
@@ -42,7 +47,8 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    MemoryManager mm(m_alignment, m_scheme);
+    vector<descriptor::Tensor*> allocated_tensors;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -87,6 +93,7 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
                                 ? in_place_outputs.at(tensor)->get_pool_offset()
                                 : mm.allocate(tensor->size());
             tensor->set_pool_offset(offset);
+            allocated_tensors.push_back(tensor);
         }
 
         if (!m_disable_memory_sharing)
@@ -100,6 +107,12 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
             }
         }
     }
+
+    mm.plan();
+    for (descriptor::Tensor* tensor : allocated_tensors)
+    {
+        tensor->set_pool_offset(mm.get_offset(tensor->get_pool_offset()));
+    }
     function->set_temporary_pool_size(mm.max_allocated());
 
     return false;
@@ -112,9 +125,18 @@ pass::MemoryManager::node::node(size_t size, block_state state)
 }
 
 pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
+    : MemoryManager(alignment,
+                    disable_memory_reuse ? allocation_scheme::NO_REUSE
+                                         : allocation_scheme::FIRST_FIT)
+{
+}
+
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
     : m_alignment{alignment}
-    , m_scheme{disable_memory_reuse ? allocation_scheme::NO_REUSE : allocation_scheme::FIRST_FIT}
+    , m_scheme{scheme}
     , m_max_allocated{0}
+    , m_clock{0}
+    , m_planned{true}
 {
     if (m_alignment == 0)
     {
@@ -131,10 +153,19 @@ size_t pass::MemoryManager::allocate(size_t size)
     case allocation_scheme::FIRST_FIT: rc = first_fit(size); break;
     case allocation_scheme::BEST_FIT: rc = best_fit(size); break;
     case allocation_scheme::NO_REUSE: rc = no_reuse_allocator(size); break;
+    case allocation_scheme::GREEDY_BY_SIZE: rc = deferred_allocate(size); break;
     }
     return rc;
 }
 
+size_t pass::MemoryManager::deferred_allocate(size_t size)
+{
+    m_blocks.push_back(
+        block{align(size, m_alignment), m_clock++, numeric_limits<size_t>::max(), 0});
+    m_planned = false;
+    return m_blocks.size() - 1;
+}
+
 size_t pass::MemoryManager::no_reuse_allocator(size_t size)
 {
     size_t offset = m_max_allocated;
@@ -220,6 +251,17 @@ size_t pass::MemoryManager::first_fit(size_t size)
 
 void pass::MemoryManager::free(size_t offset)
 {
+    if (m_scheme == allocation_scheme::GREEDY_BY_SIZE)
+    {
+        if (offset >= m_blocks.size())
+        {
+            throw runtime_error("bad free");
+        }
+        m_blocks[offset].m_end = m_clock++;
+        m_planned = false;
+        return;
+    }
+
     size_t search_offset = 0;
     bool found = false;
     for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
@@ -260,8 +302,85 @@ void pass::MemoryManager::free(size_t offset)
     }
 }
 
+void pass::MemoryManager::plan()
+{
+    if (m_planned)
+    {
+        return;
+    }
+
+    vector<size_t> order(m_blocks.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_blocks[a].m_size > m_blocks[b].m_size;
+    });
+
+    m_max_allocated = 0;
+    vector<size_t> placed;
+    vector<pair<size_t, size_t>> taken;
+    for (size_t index : order)
+    {
+        block& b = m_blocks[index];
+        taken.clear();
+        for (size_t other_index : placed)
+        {
+            const block& other = m_blocks[other_index];
+            if (other.m_begin < b.m_end && b.m_begin < other.m_end)
+            {
+                taken.push_back({other.m_offset, other.m_offset + other.m_size});
+            }
+        }
+        sort(taken.begin(), taken.end());
+
+        // Smallest gap between live allocations that fits, otherwise past the last of them
+        size_t cursor = 0;
+        size_t best_offset = 0;
+        size_t best_gap = numeric_limits<size_t>::max();
+        for (auto& range : taken)
+        {
+            if (range.first > cursor)
+            {
+                size_t gap = range.first - cursor;
+                if (gap >= b.m_size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = cursor;
+                }
+            }
+            cursor = max(cursor, range.second);
+        }
+        if (best_gap == numeric_limits<size_t>::max())
+        {
+            best_offset = cursor;
+        }
+
+        b.m_offset = best_offset;
+        m_max_allocated = max(m_max_allocated, b.m_offset + b.m_size);
+        placed.push_back(index);
+    }
+    m_planned = true;
+}
+
+size_t pass::MemoryManager::get_offset(size_t allocation) const
+{
+    if (m_scheme != allocation_scheme::GREEDY_BY_SIZE)
+    {
+        return allocation;
+    }
+    if (!m_planned || allocation >= m_blocks.size())
+    {
+        throw runtime_error("allocation has not been planned");
+    }
+    return m_blocks[allocation].m_offset;
+}
+
 void pass::MemoryManager::dump(ostream& out)
 {
+    for (const block& b : m_blocks)
+    {
+        out << "size=" << b.m_size << ", live=[" << b.m_begin << ", " << b.m_end
+            << "), offset=" << b.m_offset << "\n";
+    }
     for (const node& n : m_node_list)
     {
         out << "size=" << n.m_size << ", ";
@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -32,17 +33,6 @@ namespace ngraph
     }
 }
 
-class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
-{
-public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
-    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
-
-private:
-    size_t m_alignment;
-    bool m_disable_memory_sharing;
-};
-
 class NGRAPH_API ngraph::pass::MemoryManager
 {
 public:
@@ -56,7 +46,9 @@ public:
     {
         FIRST_FIT,
         BEST_FIT,
-        NO_REUSE
+        NO_REUSE,
+        // Offline: allocations are only recorded, and packed largest first by plan()
+        GREEDY_BY_SIZE
     };
 
     class node
@@ -70,11 +62,23 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
     // memory_manager& alignment(size_t a);
 
+    /// \returns The offset of the allocation, or for GREEDY_BY_SIZE a handle to pass to
+    ///          free() and get_offset()
     size_t allocate(size_t size);
     void free(size_t offset);
 
+    /// \brief Assigns offsets to all allocations made so far
+    ///
+    /// Only does work for GREEDY_BY_SIZE. Allocations are placed from largest to smallest,
+    /// each in the smallest gap left by the already placed allocations that are live at the
+    /// same time. Allocations are live from their allocate() until their last free() call.
+    void plan();
+    /// \returns The offset of the allocation returned by allocate(), valid after plan()
+    size_t get_offset(size_t allocation) const;
+
     void dump(std::ostream&);
 
     static size_t align(size_t x, size_t alignment);
@@ -86,12 +90,39 @@ public:
     const std::list<node>& get_node_list() const { return m_node_list; }
     size_t max_allocated() const { return m_max_allocated; }
 private:
+    struct block
+    {
+        size_t m_size;
+        size_t m_begin;
+        size_t m_end;
+        size_t m_offset;
+    };
+
     size_t first_fit(size_t size);
     size_t best_fit(size_t size);
     size_t no_reuse_allocator(size_t size);
+    size_t deferred_allocate(size_t size);
 
     std::list<node> m_node_list;
     size_t m_alignment;
     allocation_scheme m_scheme;
     size_t m_max_allocated;
+    std::vector<block> m_blocks;
+    size_t m_clock;
+    bool m_planned;
+};
+
+class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
+{
+public:
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 MemoryManager::allocation_scheme scheme =
+                     MemoryManager::allocation_scheme::FIRST_FIT);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+private:
+    size_t m_alignment;
+    bool m_disable_memory_sharing;
+    MemoryManager::allocation_scheme m_scheme;
 };
@@ -0,0 +1,416 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_scheduling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Number of search states the exhaustive search may expand before settling for the best
+    // order found so far
+    const size_t exact_search_budget = 1 << 16;
+
+    // Dependency and tensor lifetime summary of a set of nodes. Nodes are numbered by their
+    // position in the order the graph was built from, tensors by first appearance.
+    class ScheduleGraph
+    {
+    public:
+        ScheduleGraph(const vector<shared_ptr<Node>>& nodes);
+
+        size_t size() const { return m_nodes.size(); }
+        size_t simulate(const vector<size_t>& order) const;
+        vector<size_t> list_schedule() const;
+        size_t exact_schedule(vector<size_t>& order, size_t peak) const;
+
+    private:
+        struct SearchState
+        {
+            uint64_t mask;
+            size_t live;
+            size_t peak;
+            size_t budget;
+            vector<size_t> pending;
+            vector<size_t> uses;
+            vector<size_t> order;
+            vector<size_t> best_order;
+            size_t best_peak;
+            unordered_map<uint64_t, size_t> seen;
+        };
+
+        void search(SearchState& state) const;
+
+        vector<shared_ptr<Node>> m_nodes;
+        vector<vector<size_t>> m_successors;
+        vector<size_t> m_predecessor_count;
+        // Bytes of temporary outputs allocated by each node
+        vector<size_t> m_allocated;
+        // Bytes of temporary outputs nothing reads, freed as soon as the node is done
+        vector<size_t> m_transient;
+        // Temporary tensors each node reads
+        vector<vector<size_t>> m_reads;
+        vector<size_t> m_tensor_size;
+        vector<size_t> m_tensor_uses;
+    };
+}
+
+static bool is_persistent(const Node* node)
+{
+    return node->is_parameter() || node->is_constant() || node->is_output();
+}
+
+ScheduleGraph::ScheduleGraph(const vector<shared_ptr<Node>>& nodes)
+    : m_nodes(nodes)
+    , m_successors(nodes.size())
+    , m_predecessor_count(nodes.size(), 0)
+    , m_allocated(nodes.size(), 0)
+    , m_transient(nodes.size(), 0)
+    , m_reads(nodes.size())
+{
+    unordered_map<const Node*, size_t> index;
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+    {
+        index[m_nodes[i].get()] = i;
+    }
+
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+    {
+        Node* node = m_nodes[i].get();
+
+        set<size_t> predecessors;
+        for (auto& input : node->inputs())
+        {
+            auto it = index.find(input.get_source_output().get_node());
+            if (it != index.end())
+            {
+                predecessors.insert(it->second);
+            }
+        }
+        for (auto& dependency : node->get_control_dependencies())
+        {
+            auto it = index.find(dependency.get());
+            if (it != index.end())
+            {
+                predecessors.insert(it->second);
+            }
+        }
+        for (size_t predecessor : predecessors)
+        {
+            m_successors[predecessor].push_back(i);
+        }
+        m_predecessor_count[i] = predecessors.size();
+
+        if (is_persistent(node))
+        {
+            continue;
+        }
+        for (auto& output : node->outputs())
+        {
+            descriptor::Tensor& tensor = output.get_tensor();
+            size_t tensor_size = tensor.get_partial_shape().is_static() ? tensor.size() : 0;
+            size_t tensor_id = m_tensor_size.size();
+
+            set<size_t> consumers;
+            for (auto& target : output.get_target_inputs())
+            {
+                auto it = index.find(target.get_node());
+                if (it != index.end())
+                {
+                    consumers.insert(it->second);
+                }
+            }
+            for (size_t consumer : consumers)
+            {
+                m_reads[consumer].push_back(tensor_id);
+            }
+
+            m_tensor_size.push_back(tensor_size);
+            m_tensor_uses.push_back(consumers.size());
+            m_allocated[i] += tensor_size;
+            if (consumers.empty())
+            {
+                m_transient[i] += tensor_size;
+            }
+        }
+    }
+}
+
+size_t ScheduleGraph::simulate(const vector<size_t>& order) const
+{
+    vector<size_t> uses = m_tensor_uses;
+    size_t live = 0;
+    size_t peak = 0;
+    for (size_t i : order)
+    {
+        live += m_allocated[i];
+        peak = max(peak, live);
+        for (size_t tensor : m_reads[i])
+        {
+            if (--uses[tensor] == 0)
+            {
+                live -= m_tensor_size[tensor];
+            }
+        }
+        live -= m_transient[i];
+    }
+    return peak;
+}
+
+vector<size_t> ScheduleGraph::list_schedule() const
+{
+    vector<size_t> pending = m_predecessor_count;
+    vector<size_t> uses = m_tensor_uses;
+    vector<size_t> ready;
+    vector<size_t> order;
+    order.reserve(m_nodes.size());
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+    {
+        if (pending[i] == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    while (!ready.empty())
+    {
+        // Pick the ready node with the smallest change in live bytes, then the one allocating
+        // the least, then the earliest in the original order
+        size_t best = 0;
+        int64_t best_delta = 0;
+        for (size_t k = 0; k < ready.size(); ++k)
+        {
+            size_t i = ready[k];
+            int64_t delta = static_cast<int64_t>(m_allocated[i] - m_transient[i]);
+            for (size_t tensor : m_reads[i])
+            {
+                if (uses[tensor] == 1)
+                {
+                    delta -= static_cast<int64_t>(m_tensor_size[tensor]);
+                }
+            }
+            if (k == 0)
+            {
+                best_delta = delta;
+                continue;
+            }
+            size_t b = ready[best];
+            if (delta < best_delta ||
+                (delta == best_delta && (m_allocated[i] < m_allocated[b] ||
+                                         (m_allocated[i] == m_allocated[b] && i < b))))
+            {
+                best = k;
+                best_delta = delta;
+            }
+        }
+
+        size_t i = ready[best];
+        ready[best] = ready.back();
+        ready.pop_back();
+        order.push_back(i);
+        for (size_t tensor : m_reads[i])
+        {
+            --uses[tensor];
+        }
+        for (size_t successor : m_successors[i])
+        {
+            if (--pending[successor] == 0)
+            {
+                ready.push_back(successor);
+            }
+        }
+    }
+    return order;
+}
+
+size_t ScheduleGraph::exact_schedule(vector<size_t>& order, size_t peak) const
+{
+    SearchState state;
+    state.mask = 0;
+    state.live = 0;
+    state.peak = 0;
+    state.budget = exact_search_budget;
+    state.pending = m_predecessor_count;
+    state.uses = m_tensor_uses;
+    state.best_order = order;
+    state.best_peak = peak;
+    search(state);
+    order = state.best_order;
+    return state.best_peak;
+}
+
+void ScheduleGraph::search(SearchState& state) const
+{
+    if (state.order.size() == m_nodes.size())
+    {
+        if (state.peak < state.best_peak)
+        {
+            state.best_peak = state.peak;
+            state.best_order = state.order;
+        }
+        return;
+    }
+    if (state.peak >= state.best_peak || state.budget == 0)
+    {
+        return;
+    }
+    // The live bytes only depend on which nodes have run, so a set of nodes already reached
+    // with a lower peak cannot lead anywhere better
+    auto it = state.seen.find(state.mask);
+    if (it != state.seen.end() && it->second <= state.peak)
+    {
+        return;
+    }
+    state.seen[state.mask] = state.peak;
+    --state.budget;
+
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+    {
+        uint64_t bit = uint64_t{1} << i;
+        if ((state.mask & bit) != 0 || state.pending[i] != 0)
+        {
+            continue;
+        }
+
+        size_t live = state.live;
+        size_t peak = state.peak;
+        state.live += m_allocated[i];
+        state.peak = max(state.peak, state.live);
+        for (size_t tensor : m_reads[i])
+        {
+            if (--state.uses[tensor] == 0)
+            {
+                state.live -= m_tensor_size[tensor];
+            }
+        }
+        state.live -= m_transient[i];
+        for (size_t successor : m_successors[i])
+        {
+            --state.pending[successor];
+        }
+        state.mask |= bit;
+        state.order.push_back(i);
+
+        search(state);
+
+        state.order.pop_back();
+        state.mask &= ~bit;
+        for (size_t successor : m_successors[i])
+        {
+            ++state.pending[successor];
+        }
+        for (size_t tensor : m_reads[i])
+        {
+            ++state.uses[tensor];
+        }
+        state.live = live;
+        state.peak = peak;
+    }
+}
+
+pass::MemoryScheduling::MemoryScheduling(size_t alignment, size_t exact_search_limit)
+    : m_alignment(alignment)
+    , m_exact_search_limit(min(exact_search_limit, size_t{64}))
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+bool pass::MemoryScheduling::run_on_function(shared_ptr<Function> function)
+{
+    if (function->is_dynamic())
+    {
+        return false;
+    }
+
+    auto lay_out = [this, &function]() {
+        Liveness().run_on_function(function);
+        MemoryLayout(m_alignment).run_on_function(function);
+        return function->get_temporary_pool_size();
+    };
+
+    m_pool_size_before = lay_out();
+    size_t exact_search_limit = m_exact_search_limit;
+    function->set_topological_sort(
+        [exact_search_limit](const vector<shared_ptr<Node>>& root_nodes) {
+            return MemoryScheduling::schedule(root_nodes, exact_search_limit);
+        });
+    m_pool_size_after = lay_out();
+
+    // Fragmentation can make the pool of an order with a lower peak larger
+    if (m_pool_size_after > m_pool_size_before)
+    {
+        function->set_topological_sort(topological_sort<vector<shared_ptr<Node>>>);
+        m_pool_size_after = lay_out();
+    }
+    NGRAPH_DEBUG << "Temporary pool of " << function->get_name() << " went from "
+                 << m_pool_size_before << " to " << m_pool_size_after << " bytes";
+
+    return false;
+}
+
+vector<shared_ptr<Node>>
+    pass::MemoryScheduling::schedule(const vector<shared_ptr<Node>>& root_nodes,
+                                     size_t exact_search_limit)
+{
+    vector<shared_ptr<Node>> nodes = topological_sort(root_nodes);
+    ScheduleGraph graph(nodes);
+
+    vector<size_t> order(graph.size());
+    iota(order.begin(), order.end(), 0);
+    size_t peak = graph.simulate(order);
+
+    vector<size_t> listed = graph.list_schedule();
+    size_t listed_peak = graph.simulate(listed);
+    if (listed_peak < peak)
+    {
+        order = listed;
+        peak = listed_peak;
+    }
+
+    if (graph.size() <= min(exact_search_limit, size_t{64}))
+    {
+        peak = graph.exact_schedule(order, peak);
+    }
+
+    vector<shared_ptr<Node>> result;
+    result.reserve(nodes.size());
+    for (size_t i : order)
+    {
+        result.push_back(nodes[i]);
+    }
+    return result;
+}
+
+size_t pass::MemoryScheduling::get_peak_live_bytes(const vector<shared_ptr<Node>>& order)
+{
+    ScheduleGraph graph(order);
+    vector<size_t> identity(graph.size());
+    iota(identity.begin(), identity.end(), 0);
+    return graph.simulate(identity);
+}
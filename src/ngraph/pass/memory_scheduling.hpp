@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemoryScheduling;
+    }
+}
+
+/// \brief Reorders a function's ops to reduce the peak size of its temporary memory pool
+///
+/// The pass installs a topological sort that schedules ops with a greedy list scheduler: of
+/// the ops that are ready, the one that grows the live temporary bytes the least goes next.
+/// Small functions are additionally searched exhaustively, within a fixed budget. The order
+/// is only used if its simulated peak is below that of the default depth first order.
+///
+/// Liveness and MemoryLayout are run before and after installing the sort, so the function
+/// is left laid out for the new order. If the laid out pool turns out larger than before,
+/// the default topological sort is restored.
+class NGRAPH_API ngraph::pass::MemoryScheduling : public FunctionPass
+{
+public:
+    /// \param alignment Tensor alignment used for the layout, as for MemoryLayout
+    /// \param exact_search_limit Functions with at most this many nodes (at most 64) are
+    ///        also scheduled by a bounded exhaustive search, 0 disables the search
+    MemoryScheduling(size_t alignment = 1, size_t exact_search_limit = 24);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+    /// \returns Temporary pool size of the function before the last run
+    size_t get_pool_size_before() const { return m_pool_size_before; }
+    /// \returns Temporary pool size of the function after the last run
+    size_t get_pool_size_after() const { return m_pool_size_after; }
+    /// \brief Orders the nodes reachable from root_nodes to minimize peak temporary memory
+    ///
+    /// Outputs of Parameter, Constant and Result nodes are not counted, matching Liveness.
+    static std::vector<std::shared_ptr<Node>>
+        schedule(const std::vector<std::shared_ptr<Node>>& root_nodes,
+                 size_t exact_search_limit);
+
+    /// \returns Peak bytes of temporary tensors live at once when ops run in order
+    static size_t get_peak_live_bytes(const std::vector<std::shared_ptr<Node>>& order);
+
+private:
+    size_t m_alignment;
+    size_t m_exact_search_limit;
+    size_t m_pool_size_before{0};
+    size_t m_pool_size_after{0};
+};
@@ -0,0 +1,705 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sign.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/parallel_constant_folding.hpp"
+#include "ngraph/runtime/reference/abs.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/ceiling.hpp"
+#include "ngraph/runtime/reference/floor.hpp"
+#include "ngraph/runtime/reference/maximum.hpp"
+#include "ngraph/runtime/reference/minimum.hpp"
+#include "ngraph/runtime/reference/multiply.hpp"
+#include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/relu.hpp"
+#include "ngraph/runtime/reference/sign.hpp"
+#include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    enum class ElementwiseOp
+    {
+        ABS,
+        CEILING,
+        FLOOR,
+        NEGATIVE,
+        RELU,
+        SIGN,
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        MINIMUM,
+        MAXIMUM
+    };
+
+    bool get_elementwise_op(const Node* node, ElementwiseOp& op)
+    {
+        if (is_type<op::Abs>(node))
+        {
+            op = ElementwiseOp::ABS;
+        }
+        else if (is_type<op::Ceiling>(node))
+        {
+            op = ElementwiseOp::CEILING;
+        }
+        else if (is_type<op::Floor>(node))
+        {
+            op = ElementwiseOp::FLOOR;
+        }
+        else if (is_type<op::Negative>(node))
+        {
+            op = ElementwiseOp::NEGATIVE;
+        }
+        else if (is_type<op::Relu>(node))
+        {
+            op = ElementwiseOp::RELU;
+        }
+        else if (is_type<op::Sign>(node))
+        {
+            op = ElementwiseOp::SIGN;
+        }
+        else if (is_type<op::v0::Add>(node) || is_type<op::v1::Add>(node))
+        {
+            op = ElementwiseOp::ADD;
+        }
+        else if (is_type<op::v0::Subtract>(node) || is_type<op::v1::Subtract>(node))
+        {
+            op = ElementwiseOp::SUBTRACT;
+        }
+        else if (is_type<op::v0::Multiply>(node) || is_type<op::v1::Multiply>(node))
+        {
+            op = ElementwiseOp::MULTIPLY;
+        }
+        else if (is_type<op::v0::Minimum>(node) || is_type<op::v1::Minimum>(node))
+        {
+            op = ElementwiseOp::MINIMUM;
+        }
+        else if (is_type<op::v0::Maximum>(node) || is_type<op::v1::Maximum>(node))
+        {
+            op = ElementwiseOp::MAXIMUM;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // An elementwise op that can be evaluated tile by tile: every input has the element type and
+    // static shape of the single output, so no broadcasting or type conversion is involved.
+    bool is_fusable(const Node* node)
+    {
+        ElementwiseOp op;
+        if (!get_elementwise_op(node, op) || node->get_output_size() != 1 ||
+            node->get_output_partial_shape(0).is_dynamic())
+        {
+            return false;
+        }
+        switch (node->get_output_element_type(0))
+        {
+        case element::Type_t::f32:
+        case element::Type_t::f64:
+        case element::Type_t::i8:
+        case element::Type_t::i16:
+        case element::Type_t::i32:
+        case element::Type_t::i64:
+        case element::Type_t::u8:
+        case element::Type_t::u16:
+        case element::Type_t::u32:
+        case element::Type_t::u64: break;
+        default: return false;
+        }
+        for (auto& input : node->inputs())
+        {
+            if (input.get_element_type() != node->get_output_element_type(0) ||
+                input.get_partial_shape().is_dynamic() ||
+                input.get_shape() != node->get_output_shape(0))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // A fusable op whose only use is another fusable op, so it can be evaluated as part of the
+    // consumer's tree
+    bool is_absorbed(const Node* node)
+    {
+        if (!is_fusable(node))
+        {
+            return false;
+        }
+        auto targets = node->output(0).get_target_inputs();
+        return targets.size() == 1 && is_fusable(targets.begin()->get_node());
+    }
+
+    struct FusedArg
+    {
+        bool is_leaf;
+        size_t index;
+    };
+
+    struct FusedStep
+    {
+        ElementwiseOp op;
+        vector<FusedArg> args;
+        // Tile buffer the step writes; unused by the last step, which writes the result
+        size_t buffer;
+    };
+
+    template <typename T>
+    void evaluate_fused(const vector<FusedStep>& steps,
+                        size_t buffer_count,
+                        const vector<const void*>& leaves,
+                        void* out,
+                        size_t count)
+    {
+        const size_t tile_size = 4096;
+        vector<vector<T>> buffers(buffer_count, vector<T>(tile_size));
+        T* result = static_cast<T*>(out);
+        for (size_t begin = 0; begin < count; begin += tile_size)
+        {
+            size_t n = min(tile_size, count - begin);
+            auto arg = [&](const FusedStep& step, size_t i) -> const T* {
+                const FusedArg& a = step.args[i];
+                return a.is_leaf ? static_cast<const T*>(leaves[a.index]) + begin
+                                 : buffers[a.index].data();
+            };
+            for (size_t s = 0; s < steps.size(); ++s)
+            {
+                const FusedStep& step = steps[s];
+                T* dst = s + 1 == steps.size() ? result + begin : buffers[step.buffer].data();
+                switch (step.op)
+                {
+                case ElementwiseOp::ABS: runtime::reference::abs<T>(arg(step, 0), dst, n); break;
+                case ElementwiseOp::CEILING:
+                    runtime::reference::ceiling<T>(arg(step, 0), dst, n);
+                    break;
+                case ElementwiseOp::FLOOR:
+                    runtime::reference::floor<T>(arg(step, 0), dst, n);
+                    break;
+                case ElementwiseOp::NEGATIVE:
+                    runtime::reference::negate<T>(arg(step, 0), dst, n);
+                    break;
+                case ElementwiseOp::RELU: runtime::reference::relu<T>(arg(step, 0), dst, n); break;
+                case ElementwiseOp::SIGN: runtime::reference::sign<T>(arg(step, 0), dst, n); break;
+                case ElementwiseOp::ADD:
+                    runtime::reference::add<T>(arg(step, 0), arg(step, 1), dst, n);
+                    break;
+                case ElementwiseOp::SUBTRACT:
+                    runtime::reference::subtract<T>(arg(step, 0), arg(step, 1), dst, n);
+                    break;
+                case ElementwiseOp::MULTIPLY:
+                    runtime::reference::multiply<T>(arg(step, 0), arg(step, 1), dst, n);
+                    break;
+                case ElementwiseOp::MINIMUM:
+                    runtime::reference::minimum<T>(arg(step, 0), arg(step, 1), dst, n);
+                    break;
+                case ElementwiseOp::MAXIMUM:
+                    runtime::reference::maximum<T>(arg(step, 0), arg(step, 1), dst, n);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Folds the ops of one copied out constant subgraph. Not thread safe; each worker has its own.
+    class SubgraphFolder
+    {
+    public:
+        SubgraphFolder(const BuildNodeExecutorMap& cfmap)
+            : m_constant_folding(cfmap)
+            , m_enable_fusion(cfmap.empty())
+        {
+        }
+
+        void fold(const shared_ptr<Function>& f);
+
+    private:
+        // Folds nodes with ConstantFolding and clears the vector
+        void fold_nodes(vector<shared_ptr<Node>>& nodes);
+        bool fold_tree(const vector<shared_ptr<Node>>& tree);
+
+        pass::ConstantFolding m_constant_folding;
+        // Backend folding kernels are only reachable through ConstantFolding
+        bool m_enable_fusion;
+    };
+}
+
+void SubgraphFolder::fold(const shared_ptr<Function>& f)
+{
+    auto ops = f->get_ordered_ops();
+    unordered_map<Node*, size_t> position;
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        position[ops[i].get()] = i;
+    }
+
+    // Ops are visited in topological order. Ops that are not fused are collected and folded by
+    // ConstantFolding in one pass, which only has to run early when a fused tree reads one of
+    // them. Absorbed ops are skipped and evaluated with the root of their tree.
+    vector<shared_ptr<Node>> pending;
+    for (auto& node : ops)
+    {
+        if (node->is_constant() || node->is_output() ||
+            (m_enable_fusion && is_absorbed(node.get())))
+        {
+            continue;
+        }
+        if (!m_enable_fusion || !is_fusable(node.get()))
+        {
+            pending.push_back(node);
+            continue;
+        }
+
+        vector<shared_ptr<Node>> tree;
+        vector<Node*> stack{node.get()};
+        while (!stack.empty())
+        {
+            Node* tree_node = stack.back();
+            stack.pop_back();
+            tree.push_back(tree_node->shared_from_this());
+            for (auto& input_value : tree_node->input_values())
+            {
+                if (is_absorbed(input_value.get_node()))
+                {
+                    stack.push_back(input_value.get_node());
+                }
+            }
+        }
+        sort(tree.begin(),
+             tree.end(),
+             [&position](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+                 return position.at(a.get()) < position.at(b.get());
+             });
+        if (tree.size() < 2)
+        {
+            pending.push_back(node);
+            continue;
+        }
+        if (!fold_tree(tree))
+        {
+            fold_nodes(pending);
+            if (!fold_tree(tree))
+            {
+                pending.insert(pending.end(), tree.begin(), tree.end());
+            }
+        }
+    }
+    fold_nodes(pending);
+}
+
+void SubgraphFolder::fold_nodes(vector<shared_ptr<Node>>& nodes)
+{
+    if (nodes.empty())
+    {
+        return;
+    }
+    // Run the regular folding transformations on a function holding just these ops
+    OutputVector outputs;
+    for (auto& node : nodes)
+    {
+        for (auto& output : node->outputs())
+        {
+            outputs.push_back(output);
+        }
+    }
+    nodes.clear();
+    auto f = make_shared<Function>(outputs, ParameterVector{});
+    m_constant_folding.run_on_function(f);
+}
+
+bool SubgraphFolder::fold_tree(const vector<shared_ptr<Node>>& tree)
+{
+    unordered_map<Node*, size_t> steps_by_node;
+    unordered_map<Node*, size_t> leaves_by_node;
+    vector<const void*> leaves;
+    vector<FusedStep> steps;
+    vector<size_t> free_buffers;
+    size_t buffer_count = 0;
+    for (auto& node : tree)
+    {
+        FusedStep step;
+        get_elementwise_op(node.get(), step.op);
+        for (auto& input_value : node->input_values())
+        {
+            Node* arg = input_value.get_node();
+            auto step_it = steps_by_node.find(arg);
+            if (step_it != steps_by_node.end())
+            {
+                // Each absorbed op has exactly one use, so its buffer is free after this step
+                step.args.push_back({false, steps[step_it->second].buffer});
+                free_buffers.push_back(steps[step_it->second].buffer);
+                continue;
+            }
+            auto constant = as_type<op::Constant>(arg);
+            if (!constant)
+            {
+                return false;
+            }
+            auto leaf_it = leaves_by_node.find(arg);
+            if (leaf_it == leaves_by_node.end())
+            {
+                leaf_it = leaves_by_node.emplace(arg, leaves.size()).first;
+                leaves.push_back(constant->get_data_ptr());
+            }
+            step.args.push_back({true, leaf_it->second});
+        }
+        if (free_buffers.empty())
+        {
+            free_buffers.push_back(buffer_count++);
+        }
+        step.buffer = free_buffers.back();
+        free_buffers.pop_back();
+        steps_by_node[node.get()] = steps.size();
+        steps.push_back(step);
+    }
+
+    auto& root = tree.back();
+    const element::Type& et = root->get_output_element_type(0);
+    const Shape& shape = root->get_output_shape(0);
+    size_t count = shape_size(shape);
+    auto buffer = make_shared<runtime::AlignedBuffer>(count * et.size(), 64);
+    void* out = buffer->get_ptr();
+    switch (et)
+    {
+    case element::Type_t::f32:
+        evaluate_fused<float>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::f64:
+        evaluate_fused<double>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::i8:
+        evaluate_fused<int8_t>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::i16:
+        evaluate_fused<int16_t>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::i32:
+        evaluate_fused<int32_t>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::i64:
+        evaluate_fused<int64_t>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::u8:
+        evaluate_fused<uint8_t>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::u16:
+        evaluate_fused<uint16_t>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::u32:
+        evaluate_fused<uint32_t>(steps, buffer_count, leaves, out, count);
+        break;
+    case element::Type_t::u64:
+        evaluate_fused<uint64_t>(steps, buffer_count, leaves, out, count);
+        break;
+    default: NGRAPH_CHECK(false, "must be consistent with is_fusable");
+    }
+
+    shared_ptr<runtime::AlignedBuffer> data = buffer;
+    replace_node(root, make_shared<op::Constant>(et, shape, data));
+    return true;
+}
+
+pass::ParallelConstantFolding::ParallelConstantFolding(const BuildNodeExecutorMap& cfmap,
+                                                       size_t thread_count)
+    : FunctionPass()
+    , m_cfmap(cfmap)
+    , m_thread_count(thread_count)
+{
+    set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+}
+
+bool pass::ParallelConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    stopwatch timer;
+    timer.start();
+    m_folded_node_count = 0;
+    m_folded_byte_count = 0;
+
+    // Find the ops whose value only depends on Constants
+    auto ordered_ops = f->get_ordered_ops();
+    unordered_map<Node*, size_t> foldable;
+    for (size_t i = 0; i < ordered_ops.size(); ++i)
+    {
+        auto& node = ordered_ops[i];
+        if (node->is_constant() || node->is_parameter() || node->is_output() ||
+            node->get_input_size() == 0 || !node->get_control_dependencies().empty() ||
+            !node->get_control_dependents().empty())
+        {
+            continue;
+        }
+        bool all_constant = true;
+        for (auto& input_value : node->input_values())
+        {
+            Node* arg = input_value.get_node();
+            if (!arg->is_constant() && foldable.count(arg) == 0)
+            {
+                all_constant = false;
+                break;
+            }
+        }
+        if (all_constant)
+        {
+            foldable[node.get()] = i;
+        }
+    }
+
+    // Split them into connected subgraphs
+    vector<size_t> parent(ordered_ops.size());
+    iota(parent.begin(), parent.end(), 0);
+    auto find_root = [&parent](size_t i) {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (auto& entry : foldable)
+    {
+        for (auto& input_value : entry.first->input_values())
+        {
+            auto it = foldable.find(input_value.get_node());
+            if (it != foldable.end())
+            {
+                parent[find_root(it->second)] = find_root(entry.second);
+            }
+        }
+    }
+    unordered_map<size_t, size_t> component_by_root;
+    vector<vector<shared_ptr<Node>>> components;
+    for (size_t i = 0; i < ordered_ops.size(); ++i)
+    {
+        if (foldable.count(ordered_ops[i].get()) == 0)
+        {
+            continue;
+        }
+        auto it = component_by_root.find(find_root(i));
+        if (it == component_by_root.end())
+        {
+            it = component_by_root.emplace(find_root(i), components.size()).first;
+            components.emplace_back();
+        }
+        components[it->second].push_back(ordered_ops[i]);
+    }
+
+    // Copy each subgraph into a function of its own. The copies share the data of the Constants
+    // they read, and have a Result for every value used outside the subgraph.
+    struct Subgraph
+    {
+        shared_ptr<Function> function;
+        OutputVector exports;
+        // Each op of the subgraph and its copy
+        vector<pair<shared_ptr<Node>, shared_ptr<Node>>> copied_ops;
+    };
+    vector<Subgraph> subgraphs(components.size());
+    for (size_t c = 0; c < components.size(); ++c)
+    {
+        unordered_map<Node*, shared_ptr<Node>> copies;
+        unordered_set<Node*> members;
+        for (auto& node : components[c])
+        {
+            members.insert(node.get());
+            OutputVector args;
+            for (auto& input_value : node->input_values())
+            {
+                Node* arg = input_value.get_node();
+                auto it = copies.find(arg);
+                if (it == copies.end())
+                {
+                    it = copies
+                             .emplace(arg,
+                                      make_shared<op::Constant>(*static_cast<op::Constant*>(arg)))
+                             .first;
+                }
+                args.push_back(it->second->output(input_value.get_index()));
+            }
+            copies[node.get()] = node->copy_with_new_inputs(args);
+            subgraphs[c].copied_ops.emplace_back(node, copies[node.get()]);
+        }
+        OutputVector results;
+        for (auto& node : components[c])
+        {
+            for (auto& output : node->outputs())
+            {
+                for (auto& target : output.get_target_inputs())
+                {
+                    if (members.count(target.get_node()) == 0)
+                    {
+                        subgraphs[c].exports.push_back(output);
+                        results.push_back(copies.at(node.get())->output(output.get_index()));
+                        break;
+                    }
+                }
+            }
+        }
+        subgraphs[c].function = make_shared<Function>(results, ParameterVector{});
+    }
+
+    // Fold the copies, largest first so the long ones start early
+    vector<size_t> schedule(subgraphs.size());
+    iota(schedule.begin(), schedule.end(), 0);
+    sort(schedule.begin(), schedule.end(), [&components](size_t a, size_t b) {
+        return components[a].size() > components[b].size();
+    });
+    size_t thread_count = m_thread_count > 0 ? m_thread_count : thread::hardware_concurrency();
+    thread_count = min(max<size_t>(thread_count, 1), subgraphs.size());
+    vector<exception_ptr> errors(subgraphs.size());
+    if (thread_count <= 1)
+    {
+        SubgraphFolder folder(m_cfmap);
+        for (size_t i : schedule)
+        {
+            try
+            {
+                folder.fold(subgraphs[i].function);
+            }
+            catch (...)
+            {
+                errors[i] = current_exception();
+            }
+        }
+    }
+    else
+    {
+        runtime::ThreadPool pool(thread_count);
+        vector<unique_ptr<SubgraphFolder>> folders(thread_count);
+        mutex done_mutex;
+        condition_variable done_cv;
+        size_t remaining = subgraphs.size();
+        for (size_t i : schedule)
+        {
+            pool.submit([&, i]() {
+                try
+                {
+                    auto& folder = folders.at(pool.get_worker_index());
+                    if (!folder)
+                    {
+                        folder.reset(new SubgraphFolder(m_cfmap));
+                    }
+                    folder->fold(subgraphs[i].function);
+                }
+                catch (...)
+                {
+                    errors[i] = current_exception();
+                }
+                lock_guard<mutex> lock(done_mutex);
+                if (--remaining == 0)
+                {
+                    done_cv.notify_all();
+                }
+            });
+        }
+        unique_lock<mutex> lock(done_mutex);
+        done_cv.wait(lock, [&remaining]() { return remaining == 0; });
+    }
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+
+    // Splice every value that folded to a Constant back into the function. That is each export
+    // that folded, and each folded value read by an op of the subgraph that did not fold.
+    unordered_set<Node*> new_constants;
+    auto splice = [this, &new_constants](Output<Node> original, const Output<Node>& value) {
+        original.replace(value);
+        if (new_constants.insert(value.get_node()).second)
+        {
+            m_folded_byte_count += shape_size(value.get_shape()) * value.get_element_type().size();
+        }
+    };
+    for (auto& subgraph : subgraphs)
+    {
+        auto& results = subgraph.function->get_results();
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            auto value = results[i]->input_value(0);
+            if (value.get_node()->is_constant())
+            {
+                splice(subgraph.exports[i], value);
+            }
+        }
+        unordered_set<Node*> unfolded;
+        for (auto& node : subgraph.function->get_ordered_ops())
+        {
+            if (!node->is_constant() && !node->is_output())
+            {
+                unfolded.insert(node.get());
+            }
+        }
+        for (auto& copied_op : subgraph.copied_ops)
+        {
+            auto& original = copied_op.first;
+            auto& copy = copied_op.second;
+            if (unfolded.count(copy.get()) == 0)
+            {
+                continue;
+            }
+            for (size_t i = 0; i < copy->get_input_size(); ++i)
+            {
+                auto value = copy->input_value(i);
+                if (value.get_node()->is_constant() &&
+                    !original->input_value(i).get_node()->is_constant())
+                {
+                    splice(original->input_value(i), value);
+                }
+            }
+        }
+    }
+    subgraphs.clear();
+
+    for (auto& node : f->get_ordered_ops())
+    {
+        foldable.erase(node.get());
+    }
+    m_folded_node_count = foldable.size();
+    timer.stop();
+    m_folding_time_us = timer.get_microseconds();
+    NGRAPH_DEBUG << "ParallelConstantFolding folded " << m_folded_node_count << " nodes into "
+                 << m_folded_byte_count << " bytes of constants in " << m_folding_time_us << "us";
+    return m_folded_node_count > 0;
+}
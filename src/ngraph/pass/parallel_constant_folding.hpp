@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ParallelConstantFolding;
+    }
+}
+
+/// \brief Constant folding that evaluates independent constant subgraphs concurrently
+///
+/// The function is partitioned into maximal connected subgraphs whose inputs are all
+/// Constants. Each subgraph is copied out and folded on a worker thread with the same
+/// transformations as ConstantFolding, and the results are spliced back into the function.
+/// Trees of same-shape elementwise arithmetic ops over Constants are evaluated tile by tile in a
+/// single sweep, so their intermediate values are never materialized as constants.
+class NGRAPH_API ngraph::pass::ParallelConstantFolding : public FunctionPass
+{
+public:
+    /// \param cfmap Backend specific folding kernels, as for ConstantFolding
+    /// \param thread_count Number of worker threads, 0 for one per hardware thread
+    ParallelConstantFolding(const BuildNodeExecutorMap& cfmap = BuildNodeExecutorMap(),
+                            size_t thread_count = 0);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \returns Number of nodes removed from the function by the last run
+    size_t get_folded_node_count() const { return m_folded_node_count; }
+    /// \returns Bytes of constant data created by the last run
+    size_t get_folded_byte_count() const { return m_folded_byte_count; }
+    /// \returns Wall clock time of the last run in microseconds
+    size_t get_folding_time_us() const { return m_folding_time_us; }
+private:
+    BuildNodeExecutorMap m_cfmap;
+    size_t m_thread_count;
+    size_t m_folded_node_count{0};
+    size_t m_folded_byte_count{0};
+    size_t m_folding_time_us{0};
+};
@@ -23,6 +23,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/pattern/op/or.hpp"
 
 namespace ngraph
 {
@@ -160,6 +161,40 @@ namespace ngraph
             return pattern_node->match_value(this, pattern_value, graph_value);
         }
 
+        static bool collect_root_types(const Output<Node>& pattern_value,
+                                       std::set<NodeTypeInfo>& root_types)
+        {
+            auto pattern_node = pattern_value.get_node();
+            if (!pattern_node->is_pattern())
+            {
+                root_types.insert(pattern_node->get_type_info());
+                return true;
+            }
+            // An Or matches whatever one of its alternatives matches
+            if (is_type<op::Or>(pattern_node))
+            {
+                for (auto& alternative : pattern_node->input_values())
+                {
+                    if (!collect_root_types(alternative, root_types))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            return false;
+        }
+
+        std::set<NodeTypeInfo> Matcher::get_root_types() const
+        {
+            std::set<NodeTypeInfo> root_types;
+            if (!m_pattern_node.get_node() || !collect_root_types(m_pattern_node, root_types))
+            {
+                root_types.clear();
+            }
+            return root_types;
+        }
+
         bool Matcher::match_permutation(const OutputVector& pattern_args, const OutputVector& args)
         {
             for (size_t i = 0; i < args.size(); i++)
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory.h>
+#include <set>
 
 #include "ngraph/node.hpp"
 #include "ngraph/op/constant.hpp"
@@ -153,6 +154,11 @@ namespace ngraph
             const std::string& get_name() { return m_name; }
             std::shared_ptr<Node> get_pattern() { return m_pattern_node.as_single_output_node(); }
             Output<Node> get_pattern_value() { return m_pattern_node; }
+            /// \brief Returns the op types a graph node must have for this matcher to match it
+            ///
+            /// An empty set means the pattern root (e.g. a Label or Any) may match a node of any
+            /// type. GraphRewrite uses this to skip matchers that cannot match a node.
+            std::set<NodeTypeInfo> get_root_types() const;
             std::shared_ptr<Node> get_match_root();
             Output<Node> get_match_value();
             PatternMap get_pattern_map() const;
@@ -152,6 +152,11 @@ public:
     ///     parameter value is valid.
     virtual bool set_config(const std::map<std::string, std::string>& config, std::string& error);
 
+    /// \brief The configuration that executables compiled now are built with
+    /// \returns The set_config key, value pairs that change compiled executables, including
+    ///     their defaults. Empty if the backend has no such configuration.
+    virtual std::map<std::string, std::string> get_config() const { return {}; }
+
     static void set_backend_shared_library_search_directory(const std::string& path);
     static const std::string& get_backend_shared_library_search_directory();
 
@@ -0,0 +1,350 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/batcher.hpp"
+#include "ngraph/specialize_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Checks a request tensor against the unbatched Parameter or Result it is bound to, so a
+    // bad request is rejected by submit() instead of failing the batch it would join
+    void check_request_tensor(const char* kind,
+                              size_t index,
+                              const runtime::Tensor& tensor,
+                              const element::Type& type,
+                              const PartialShape& shape,
+                              size_t batch_size)
+    {
+        NGRAPH_CHECK(tensor.get_element_type() == type,
+                     "Batcher request ",
+                     kind,
+                     " ",
+                     index,
+                     " has element type ",
+                     tensor.get_element_type(),
+                     ", expected ",
+                     type);
+        const Shape& tensor_shape = tensor.get_shape();
+        bool compatible = tensor_shape.size() == static_cast<size_t>(shape.rank()) &&
+                          tensor_shape[0] == batch_size;
+        for (size_t i = 1; compatible && i < tensor_shape.size(); ++i)
+        {
+            compatible = tensor_shape[i] == static_cast<size_t>(shape[i]);
+        }
+        NGRAPH_CHECK(compatible,
+                     "Batcher request ",
+                     kind,
+                     " ",
+                     index,
+                     " has shape ",
+                     tensor_shape,
+                     ", expected batch ",
+                     batch_size,
+                     " and shape ",
+                     shape,
+                     " on the other axes");
+    }
+
+    // The rank and every axis but the batch axis must be known to check requests
+    bool is_static_after_batch_axis(const PartialShape& shape)
+    {
+        if (shape.rank().is_dynamic() || static_cast<size_t>(shape.rank()) == 0)
+        {
+            return false;
+        }
+        for (size_t i = 1; i < static_cast<size_t>(shape.rank()); ++i)
+        {
+            if (shape[i].is_dynamic())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+runtime::Batcher::Batcher(const shared_ptr<Backend>& backend,
+                          const shared_ptr<Function>& function,
+                          size_t max_batch_size,
+                          chrono::microseconds latency_budget)
+    : m_backend(backend)
+    , m_max_batch_size(max_batch_size)
+    , m_latency_budget(latency_budget)
+{
+    NGRAPH_CHECK(max_batch_size > 0, "Batcher needs a max_batch_size of at least 1");
+
+    // Free the batch axis so the function can be specialized to any batch size
+    m_function = clone_function(*function);
+    for (const shared_ptr<op::Parameter>& parameter : m_function->get_parameters())
+    {
+        PartialShape shape = parameter->get_output_partial_shape(0);
+        NGRAPH_CHECK(is_static_after_batch_axis(shape),
+                     "Batcher needs Parameters with a batch axis and static other axes, got "
+                     "shape ",
+                     shape);
+        NGRAPH_CHECK(parameter->get_element_type().is_static(),
+                     "Batcher needs Parameters with a static element type");
+        vector<Dimension> dimensions(static_cast<size_t>(shape.rank()));
+        for (size_t i = 1; i < dimensions.size(); ++i)
+        {
+            dimensions[i] = shape[i];
+        }
+        parameter->set_partial_shape(dimensions);
+    }
+    m_function->validate_nodes_and_infer_types();
+    for (const shared_ptr<op::Result>& result : m_function->get_results())
+    {
+        NGRAPH_CHECK(is_static_after_batch_axis(result->get_output_partial_shape(0)),
+                     "Batcher needs Results with a batch axis and static other axes, got shape ",
+                     result->get_output_partial_shape(0));
+    }
+
+    m_worker = thread(&Batcher::worker_loop, this);
+}
+
+runtime::Batcher::~Batcher()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_worker.join();
+}
+
+size_t runtime::Batcher::get_call_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_call_count;
+}
+
+future<bool> runtime::Batcher::submit(const vector<shared_ptr<Tensor>>& outputs,
+                                      const vector<shared_ptr<Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == m_function->get_parameters().size(),
+                 "Batcher request has ",
+                 inputs.size(),
+                 " inputs, the function has ",
+                 m_function->get_parameters().size(),
+                 " Parameters");
+    NGRAPH_CHECK(outputs.size() == m_function->get_results().size(),
+                 "Batcher request has ",
+                 outputs.size(),
+                 " outputs, the function has ",
+                 m_function->get_results().size(),
+                 " Results");
+    size_t batch_size = 1;
+    if (!inputs.empty())
+    {
+        NGRAPH_CHECK(!inputs[0]->get_shape().empty(),
+                     "Batcher request input 0 has no batch axis");
+        batch_size = inputs[0]->get_shape()[0];
+    }
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        const shared_ptr<op::Parameter>& parameter = m_function->get_parameters()[i];
+        check_request_tensor("input",
+                             i,
+                             *inputs[i],
+                             parameter->get_element_type(),
+                             parameter->get_output_partial_shape(0),
+                             batch_size);
+    }
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+        const shared_ptr<op::Result>& result = m_function->get_results()[i];
+        check_request_tensor("output",
+                             i,
+                             *outputs[i],
+                             result->get_element_type(),
+                             result->get_output_partial_shape(0),
+                             batch_size);
+    }
+
+    Request request;
+    request.m_outputs = outputs;
+    request.m_inputs = inputs;
+    request.m_batch_size = batch_size;
+    request.m_arrival = chrono::steady_clock::now();
+    future<bool> result = request.m_promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(move(request));
+        m_pending_rows += batch_size;
+    }
+    m_cv.notify_one();
+    return result;
+}
+
+void runtime::Batcher::worker_loop()
+{
+    while (true)
+    {
+        vector<Request> batch;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                // Stopping and no requests left
+                return;
+            }
+            // Give other requests until the oldest one's budget runs out to join it
+            m_cv.wait_until(lock, m_queue.front().m_arrival + m_latency_budget, [this] {
+                return m_stop || m_pending_rows >= m_max_batch_size;
+            });
+            size_t rows = 0;
+            while (!m_queue.empty() &&
+                   (batch.empty() || rows + m_queue.front().m_batch_size <= m_max_batch_size))
+            {
+                rows += m_queue.front().m_batch_size;
+                batch.push_back(move(m_queue.front()));
+                m_queue.pop_front();
+            }
+            m_pending_rows -= rows;
+            m_call_count++;
+        }
+        run_batch(batch);
+    }
+}
+
+void runtime::Batcher::run_batch(vector<Request>& batch)
+{
+    try
+    {
+        size_t rows = 0;
+        for (const Request& request : batch)
+        {
+            rows += request.m_batch_size;
+        }
+        shared_ptr<Executable> executable = get_executable(rows);
+
+        // Concatenate each input along the batch axis, which for row-major tensors is a
+        // concatenation of their bytes
+        vector<vector<char>> input_data(executable->get_parameters().size());
+        vector<shared_ptr<Tensor>> inputs;
+        for (size_t i = 0; i < input_data.size(); ++i)
+        {
+            const shared_ptr<op::Parameter>& parameter = executable->get_parameters()[i];
+            size_t offset = 0;
+            for (const Request& request : batch)
+            {
+                offset += request.m_inputs[i]->get_size_in_bytes();
+            }
+            input_data[i].resize(offset);
+            offset = 0;
+            for (const Request& request : batch)
+            {
+                size_t size = request.m_inputs[i]->get_size_in_bytes();
+                request.m_inputs[i]->read(input_data[i].data() + offset, size);
+                offset += size;
+            }
+            NGRAPH_CHECK(offset == shape_size(parameter->get_shape()) *
+                                       parameter->get_element_type().size(),
+                         "Batcher input ",
+                         i,
+                         " has ",
+                         offset,
+                         " bytes for Parameter shape ",
+                         parameter->get_shape());
+            inputs.push_back(m_backend->create_tensor(parameter->get_element_type(),
+                                                      parameter->get_shape(),
+                                                      input_data[i].data()));
+        }
+        vector<vector<char>> output_data(executable->get_results().size());
+        vector<shared_ptr<Tensor>> outputs;
+        for (size_t i = 0; i < output_data.size(); ++i)
+        {
+            const shared_ptr<op::Result>& result = executable->get_results()[i];
+            NGRAPH_CHECK(!result->get_shape().empty() && result->get_shape()[0] == rows,
+                         "Batcher needs Results with the batch on axis 0, got shape ",
+                         result->get_shape(),
+                         " for batch ",
+                         rows);
+            output_data[i].resize(shape_size(result->get_shape()) *
+                                  result->get_element_type().size());
+            outputs.push_back(m_backend->create_tensor(
+                result->get_element_type(), result->get_shape(), output_data[i].data()));
+        }
+
+        bool ok = executable->call(outputs, inputs);
+
+        // Split each output back along the batch axis
+        for (size_t i = 0; i < output_data.size(); ++i)
+        {
+            size_t row_size = output_data[i].size() / rows;
+            size_t offset = 0;
+            for (Request& request : batch)
+            {
+                size_t size = row_size * request.m_batch_size;
+                NGRAPH_CHECK(size == request.m_outputs[i]->get_size_in_bytes(),
+                             "Batcher output ",
+                             i,
+                             " has ",
+                             size,
+                             " bytes for a request tensor of ",
+                             request.m_outputs[i]->get_size_in_bytes());
+                request.m_outputs[i]->write(output_data[i].data() + offset, size);
+                offset += size;
+            }
+        }
+        for (Request& request : batch)
+        {
+            request.m_promise.set_value(ok);
+        }
+    }
+    catch (...)
+    {
+        for (Request& request : batch)
+        {
+            request.m_promise.set_exception(current_exception());
+        }
+    }
+}
+
+shared_ptr<runtime::Executable> runtime::Batcher::get_executable(size_t batch_size)
+{
+    auto it = m_executables.find(batch_size);
+    if (it != m_executables.end())
+    {
+        return it->second;
+    }
+
+    vector<element::Type> types;
+    vector<PartialShape> shapes;
+    for (const shared_ptr<op::Parameter>& parameter : m_function->get_parameters())
+    {
+        PartialShape shape = parameter->get_output_partial_shape(0);
+        vector<Dimension> dimensions(static_cast<size_t>(shape.rank()));
+        dimensions[0] = batch_size;
+        for (size_t i = 1; i < dimensions.size(); ++i)
+        {
+            dimensions[i] = shape[i];
+        }
+        types.push_back(parameter->get_element_type());
+        shapes.push_back(dimensions);
+    }
+    shared_ptr<Function> specialized = specialize_function(
+        m_function, types, shapes, vector<void*>(types.size(), nullptr));
+    shared_ptr<Executable> executable = m_backend->compile(specialized);
+    m_executables[batch_size] = executable;
+    return executable;
+}
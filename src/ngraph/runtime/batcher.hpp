@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Batcher;
+    }
+}
+
+/// \brief Coalesces concurrent requests along the batch axis and runs them as one call.
+///
+/// Requests queued with submit() are collected by a worker thread until max_batch_size rows
+/// are pending or the oldest request has waited latency_budget. The inputs of the collected
+/// requests are concatenated along axis 0, run by an executable compiled for that batch size,
+/// and the outputs are split back along axis 0 into each request's tensors. An executable is
+/// compiled with specialize_function the first time a batch size is seen and kept for reuse.
+///
+/// Axis 0 of every Parameter and Result of the function is the batch axis, and the rest of
+/// each shape must be static and must not depend on it.
+class NGRAPH_API ngraph::runtime::Batcher
+{
+public:
+    /// \param backend The backend that compiles and runs the batched executables
+    /// \param function The function to run. Its Parameters may have any batch dimension.
+    /// \param max_batch_size The largest number of rows run in one call. A request with more
+    ///     rows than this runs on its own.
+    /// \param latency_budget How long the oldest pending request may wait for others to join
+    ///     its batch
+    Batcher(const std::shared_ptr<Backend>& backend,
+            const std::shared_ptr<Function>& function,
+            size_t max_batch_size,
+            std::chrono::microseconds latency_budget);
+
+    /// \brief Runs the requests still queued and stops the worker thread
+    ~Batcher();
+
+    /// \brief Queue a request.
+    ///
+    /// The tensors must stay alive until the returned future is ready. Tensors whose element
+    /// type or shape does not match the function throw here, so they never reach a batch.
+    /// \param outputs One tensor per Result, with axis 0 equal to the batch of the inputs
+    /// \param inputs One tensor per Parameter, all with the same size on axis 0
+    /// \returns A future holding the result of the batched call, or the exception it threw
+    std::future<bool> submit(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                             const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    size_t get_max_batch_size() const { return m_max_batch_size; }
+    std::chrono::microseconds get_latency_budget() const { return m_latency_budget; }
+    /// \brief Number of batched calls run so far
+    size_t get_call_count() const;
+
+private:
+    Batcher(const Batcher&) = delete;
+    Batcher& operator=(const Batcher&) = delete;
+
+    struct Request
+    {
+        std::vector<std::shared_ptr<Tensor>> m_outputs;
+        std::vector<std::shared_ptr<Tensor>> m_inputs;
+        size_t m_batch_size;
+        std::chrono::steady_clock::time_point m_arrival;
+        std::promise<bool> m_promise;
+    };
+
+    void worker_loop();
+    void run_batch(std::vector<Request>& batch);
+    std::shared_ptr<Executable> get_executable(size_t batch_size);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_latency_budget;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Request> m_queue;
+    // Rows in m_queue, guarded by m_mutex
+    size_t m_pending_rows{0};
+    size_t m_call_count{0};
+    bool m_stop{false};
+
+    // Only used by the worker thread
+    std::map<size_t, std::shared_ptr<Executable>> m_executables;
+    std::thread m_worker;
+};
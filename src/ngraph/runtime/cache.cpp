@@ -14,118 +14,174 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include "ngraph/runtime/cache.hpp"
+#include <chrono>
+#include <cstring>
+#include <limits>
+
 #include "ngraph/env_util.hpp"
+#include "ngraph/runtime/cache.hpp"
 
 using namespace ngraph;
 using namespace std;
 
-// Constructor
-runtime::LRUCache::LRUCache()
+static uint64_t mix(uint64_t value)
+{
+    // splitmix64 finalizer
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+void runtime::CacheKeyBuilder::add(const void* data, size_t size)
 {
-    int32_t cache_size = getenv_int("NGRAPH_CACHE_SIZE");
-    if (cache_size <= 0)
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        m_hash0 = (m_hash0 ^ bytes[i]) * 1099511628211ULL;
+    }
+    // The second hash consumes whole words so the two hashes fail independently
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
     {
-        m_cache_size = 1024; // TODO(nbpatel): Figure out a default size for the cache
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        m_hash1 = mix(m_hash1 ^ word);
     }
-    else
+    uint64_t tail = size;
+    for (; i < size; ++i)
     {
-        m_cache_size = cache_size;
+        tail = (tail << 8) | bytes[i];
     }
+    m_hash1 = mix(m_hash1 ^ tail);
+}
+
+void runtime::CacheKeyBuilder::add(uint64_t value)
+{
+    add(&value, sizeof(value));
+}
 
-    m_map = {};
-    m_list = {};
+runtime::CacheKey runtime::CacheKeyBuilder::get_key() const
+{
+    return CacheKey{{m_hash0, m_hash1}};
 }
 
-// Destructor
-runtime::LRUCache::~LRUCache()
+static uint64_t get_time_stamp()
 {
-    m_list.clear();
-    m_map.clear();
-    m_clone_function_map.clear();
+    return chrono::steady_clock::now().time_since_epoch().count();
 }
 
-void runtime::LRUCache::convert_shape_to_string(const vector<int>& shape, ostringstream& key)
+runtime::LRUCache::LRUCache(size_t capacity)
+    : m_capacity(capacity)
 {
-    if (!shape.empty())
+    if (m_capacity == 0)
     {
-        std::copy(shape.begin(), shape.end(), std::ostream_iterator<int>(key, ", "));
+        int32_t cache_size = getenv_int("NGRAPH_CACHE_SIZE");
+        m_capacity = cache_size > 0 ? cache_size : 1024;
     }
 }
 
-void runtime::LRUCache::add_entry(const vector<int>& shape,
-                                  shared_ptr<runtime::Executable> exec,
-                                  shared_ptr<Function> func)
+shared_ptr<const runtime::LRUCache::Entry> runtime::LRUCache::get(const CacheKey& key)
 {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    // check if the list is empty
-    if (m_list.size() == m_cache_size)
+    Shard& shard = get_shard(key);
+    lock_guard<mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end())
     {
-        ostringstream key;
-        convert_shape_to_string(m_list.back(), key);
-        m_list.pop_back();
-        m_map.erase(key.str());
+        ++shard.miss_count;
+        return nullptr;
     }
-
-    convert_shape_to_string(shape, key);
-    m_map.insert({key.str(), exec});
-    m_list.push_front(shape);
-    m_clone_function_map.insert({key.str(), func});
+    ++shard.hit_count;
+    it->second->last_used.store(get_time_stamp(), memory_order_relaxed);
+    return it->second;
 }
 
-bool runtime::LRUCache::is_cached(const vector<int>& shape)
+shared_ptr<const runtime::LRUCache::Entry>
+    runtime::LRUCache::add(const CacheKey& key,
+                           shared_ptr<Executable> executable,
+                           shared_ptr<Function> function)
 {
-    for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
+    lock_guard<mutex> write_lock(m_write_mutex);
+    shared_ptr<Entry> entry;
     {
-        if (*itr == shape)
+        Shard& shard = get_shard(key);
+        lock_guard<mutex> lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it != shard.map.end())
         {
-            return true;
+            return it->second;
         }
+        entry = make_shared<Entry>();
+        entry->executable = executable;
+        entry->function = function;
+        entry->last_used = get_time_stamp();
+        shard.map.insert({key, entry});
     }
-    return false;
+    ++m_size;
+    evict();
+    return entry;
 }
 
-shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector<int>& shape)
+void runtime::LRUCache::set_capacity(size_t capacity)
 {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
+    NGRAPH_CHECK(capacity > 0, "LRUCache capacity must be positive");
+    lock_guard<mutex> lock(m_write_mutex);
+    m_capacity = capacity;
+    evict();
+}
 
-    // find the entry and return the function
-    auto it = m_map.find(key.str());
-    if (it == m_map.end())
+size_t runtime::LRUCache::get_hit_count() const
+{
+    size_t count = 0;
+    for (Shard& shard : m_shards)
     {
-        throw ngraph_error("Entry not found in cache");
+        lock_guard<mutex> lock(shard.mutex);
+        count += shard.hit_count;
     }
-    else
+    return count;
+}
+
+size_t runtime::LRUCache::get_miss_count() const
+{
+    size_t count = 0;
+    for (Shard& shard : m_shards)
     {
-        // update list to push this reference to the front
-        for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
-        {
-            if (*itr == shape)
-            {
-                m_list.remove(shape);
-                m_list.push_front(shape);
-                break;
-            }
-        }
-        return it->second;
+        lock_guard<mutex> lock(shard.mutex);
+        count += shard.miss_count;
     }
+    return count;
 }
 
-// Need the clone function to get the output shape so that
-// storage can be allocated for output
-shared_ptr<Function> runtime::LRUCache::get_cloned_function(const vector<int>& shape)
+void runtime::LRUCache::evict()
 {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
-    // find the entry and return the function
-    auto it = m_clone_function_map.find(key.str());
-    if (it == m_clone_function_map.end())
+    while (m_size > m_capacity)
     {
-        throw ngraph_error("Cloned function not found");
+        // Only writers insert or erase and they hold m_write_mutex, so the oldest entry found
+        // here is still there when its shard is locked again to erase it
+        Shard* oldest_shard = nullptr;
+        CacheKey oldest_key{{0, 0}};
+        uint64_t oldest_use = numeric_limits<uint64_t>::max();
+        for (Shard& shard : m_shards)
+        {
+            lock_guard<mutex> lock(shard.mutex);
+            for (const auto& item : shard.map)
+            {
+                uint64_t last_used = item.second->last_used.load(memory_order_relaxed);
+                if (last_used <= oldest_use)
+                {
+                    oldest_use = last_used;
+                    oldest_key = item.first;
+                    oldest_shard = &shard;
+                }
+            }
+        }
+        {
+            lock_guard<mutex> lock(oldest_shard->mutex);
+            oldest_shard->map.erase(oldest_key);
+        }
+        --m_size;
+        ++m_eviction_count;
     }
-    return it->second;
 }
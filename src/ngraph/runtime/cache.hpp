@@ -16,46 +16,108 @@
 
 #pragma once
 
-#include <algorithm>
-#include <iostream>
-#include <iterator>
-#include <list>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <sstream>
-#include <string>
 #include <unordered_map>
+
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/executable.hpp"
-#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
     namespace runtime
     {
-        class LRUCache : public std::enable_shared_from_this<LRUCache>
+        /// \brief A fixed size cache key: a 128 bit hash of everything added to the builder
+        struct CacheKey
+        {
+            uint64_t hash[2];
+
+            bool operator==(const CacheKey& other) const
+            {
+                return hash[0] == other.hash[0] && hash[1] == other.hash[1];
+            }
+            bool operator!=(const CacheKey& other) const { return !(*this == other); }
+        };
+
+        struct CacheKeyHash
+        {
+            size_t operator()(const CacheKey& key) const { return key.hash[0]; }
+        };
+
+        /// \brief Builds a CacheKey incrementally without allocating
+        class CacheKeyBuilder
         {
         public:
-            using GraphCache = std::unordered_map<std::string, std::shared_ptr<Executable>>;
-            using ClonedFunctionMap = std::unordered_map<std::string, std::shared_ptr<Function>>;
+            void add(const void* data, size_t size);
+            void add(uint64_t value);
+            CacheKey get_key() const;
 
-            LRUCache();
+        private:
+            uint64_t m_hash0{14695981039346656037ULL};
+            uint64_t m_hash1{0x9e3779b97f4a7c15ULL};
+        };
+
+        /// \brief Least recently used cache of executables compiled for specialized functions
+        ///
+        /// The table is split into shards by key, each with its own mutex, so concurrent
+        /// lookups of different keys rarely wait on each other. A hit records the time in the
+        /// entry's own atomic stamp and writes nothing shared. Adding an entry scans the
+        /// stamps of all shards to evict the least recently used one.
+        class NGRAPH_API LRUCache
+        {
+        public:
+            struct Entry
+            {
+                std::shared_ptr<Executable> executable;
+                std::shared_ptr<Function> function;
+                mutable std::atomic<uint64_t> last_used{0};
+            };
 
-            virtual ~LRUCache();
+            /// \param capacity Maximum number of entries, 0 for the NGRAPH_CACHE_SIZE
+            ///     environment variable or 1024 if that is not set
+            LRUCache(size_t capacity = 0);
 
-            void add_entry(const std::vector<int>& shape,
-                           std::shared_ptr<Executable> exec,
-                           std::shared_ptr<Function> func);
-            bool is_cached(const std::vector<int>& shape);
-            std::shared_ptr<Executable> get_cached_entry(const std::vector<int>& shape);
-            void convert_shape_to_string(const std::vector<int>& shape, std::ostringstream& key);
-            std::shared_ptr<Function> get_cloned_function(const std::vector<int>& shape);
+            /// \returns The entry for key, or nullptr if there is none
+            std::shared_ptr<const Entry> get(const CacheKey& key);
 
+            /// \brief Adds an entry, evicting the least recently used one if the cache is full.
+            ///     If another thread added an entry for key first, that entry is kept.
+            /// \returns The entry now cached for key
+            std::shared_ptr<const Entry> add(const CacheKey& key,
+                                             std::shared_ptr<Executable> executable,
+                                             std::shared_ptr<Function> function);
+
+            void set_capacity(size_t capacity);
+            size_t get_capacity() const { return m_capacity; }
+            size_t size() const { return m_size; }
+            size_t get_hit_count() const;
+            size_t get_miss_count() const;
+            size_t get_eviction_count() const { return m_eviction_count; }
         private:
-            int m_cache_size;
-            GraphCache m_map;
-            ClonedFunctionMap m_clone_function_map;
-            std::list<std::vector<int>> m_list;
-            std::mutex m_mutex;
+            using Map = std::unordered_map<CacheKey, std::shared_ptr<const Entry>, CacheKeyHash>;
+
+            struct Shard
+            {
+                std::mutex mutex;
+                Map map;
+                // Counted per shard so lookups do not share a counter
+                size_t hit_count{0};
+                size_t miss_count{0};
+            };
+            static const size_t SHARD_COUNT = 16;
+
+            Shard& get_shard(const CacheKey& key) { return m_shards[key.hash[1] % SHARD_COUNT]; }
+            // Called with m_write_mutex held
+            void evict();
+
+            mutable Shard m_shards[SHARD_COUNT];
+            // Serializes add and set_capacity, lookups only lock a shard
+            std::mutex m_write_mutex;
+            std::atomic<size_t> m_capacity;
+            std::atomic<size_t> m_size{0};
+            std::atomic<size_t> m_eviction_count{0};
         };
     }
 }
@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::FusedElementwise)
+            {
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+                auto& functors = external_function->get_functors();
+
+                kernel::FusedElementwiseProgram program;
+                program.input_modes = fused->get_input_modes();
+                program.program = fused->get_program();
+                program.count = out[0].get_size();
+
+                vector<size_t> arg_buffer_indices;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                    program.input_counts.push_back(arg.get_size());
+                    program.boolean_inputs.push_back(arg.get_element_type() == element::boolean);
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&, program, arg_buffer_indices, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    vector<void*> inputs(arg_buffer_indices.size());
+                    for (size_t i = 0; i < arg_buffer_indices.size(); i++)
+                    {
+                        inputs[i] = ctx->buffer_data[arg_buffer_indices[i]];
+                    }
+                    kernel::fused_elementwise(
+                        program, inputs, ctx->buffer_data[out_buffer_index], ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_fused_elementwise_cpp()
+            {
+                REGISTER_OP_BUILDER(FusedElementwise);
+            }
+        }
+    }
+}
@@ -27,6 +27,7 @@
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
@@ -118,8 +119,34 @@ shared_ptr<runtime::Executable>
             return rc;
         }
     }
-    rc = make_shared<CPU_Executable>(
-        func, pass_config, get_host_memory_allocator(), performance_counters_enabled);
+    shared_ptr<executor::DedicatedThreadPool> thread_pool;
+    {
+        std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        if (m_thread_pool_scope == ThreadPoolScope::Executable)
+        {
+            // Executables that share the process default to one thread each rather than a
+            // pool of every core apiece
+            executor::ThreadPoolConfig pool_config = *m_thread_pool_config;
+            if (pool_config.num_threads < 1 && pool_config.cpus.empty())
+            {
+                pool_config.num_threads = 1;
+            }
+            thread_pool = make_shared<executor::DedicatedThreadPool>(pool_config);
+        }
+        else if (m_thread_pool_scope == ThreadPoolScope::Backend)
+        {
+            if (!m_thread_pool)
+            {
+                m_thread_pool = make_shared<executor::DedicatedThreadPool>(*m_thread_pool_config);
+            }
+            thread_pool = m_thread_pool;
+        }
+    }
+    rc = make_shared<CPU_Executable>(func,
+                                     pass_config,
+                                     get_host_memory_allocator(),
+                                     performance_counters_enabled,
+                                     thread_pool);
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
         m_exec_map.insert({func, rc});
@@ -141,3 +168,103 @@ bool runtime::cpu::CPU_Backend::is_supported_property(const Property prop) const
 
     return false;
 }
+
+bool runtime::cpu::CPU_Backend::set_config(const map<string, string>& config, string& error)
+{
+    error = "";
+    auto scope = m_thread_pool_scope;
+    auto pool_config = m_thread_pool_config ? *m_thread_pool_config : executor::ThreadPoolConfig();
+    bool rc = false;
+    try
+    {
+        auto it = config.find("thread_pool");
+        if (it != config.end())
+        {
+            if (it->second == "shared")
+            {
+                scope = ThreadPoolScope::Shared;
+            }
+            else if (it->second == "backend")
+            {
+                scope = ThreadPoolScope::Backend;
+            }
+            else if (it->second == "executable")
+            {
+                scope = ThreadPoolScope::Executable;
+            }
+            else
+            {
+                throw ngraph_error("thread_pool must be shared, backend or executable, got '" +
+                                   it->second + "'");
+            }
+            rc = true;
+        }
+        it = config.find("intra_op_threads");
+        if (it != config.end())
+        {
+            pool_config.num_threads = parse_string<int>(it->second);
+            if (pool_config.num_threads < 1)
+            {
+                throw ngraph_error("intra_op_threads must be positive, got '" + it->second + "'");
+            }
+            rc = true;
+        }
+        it = config.find("cpu_affinity");
+        if (it != config.end())
+        {
+            pool_config.cpus = executor::parse_cpu_list(it->second);
+            rc = true;
+        }
+        it = config.find("numa_node");
+        if (it != config.end())
+        {
+            if (config.find("cpu_affinity") != config.end())
+            {
+                throw ngraph_error("cpu_affinity and numa_node cannot both be set");
+            }
+            pool_config.cpus = executor::get_numa_node_cpus(parse_string<int>(it->second));
+            if (pool_config.cpus.empty())
+            {
+                throw ngraph_error("numa_node " + it->second + " has no cpus");
+            }
+            rc = true;
+        }
+        it = config.find("wait_policy");
+        if (it != config.end())
+        {
+            if (it->second == "spin_then_sleep")
+            {
+                pool_config.wait_policy = executor::WaitPolicy::SpinThenSleep;
+            }
+            else if (it->second == "sleep")
+            {
+                pool_config.wait_policy = executor::WaitPolicy::Sleep;
+            }
+            else
+            {
+                throw ngraph_error("wait_policy must be spin_then_sleep or sleep, got '" +
+                                   it->second + "'");
+            }
+            rc = true;
+        }
+    }
+    catch (const exception& e)
+    {
+        error = e.what();
+        return false;
+    }
+
+    if (rc)
+    {
+        // Executables compiled before keep the pool they run on
+        std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+        m_thread_pool_scope = scope;
+        m_thread_pool_config = make_shared<executor::ThreadPoolConfig>(pool_config);
+        m_thread_pool = nullptr;
+    }
+    else
+    {
+        error = "set_config: no supported configuration keys";
+    }
+    return rc;
+}
@@ -35,6 +35,11 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            namespace executor
+            {
+                struct ThreadPoolConfig;
+                class DedicatedThreadPool;
+            }
             BackendConstructor CPU_BACKEND_API get_backend_constructor_pointer();
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
@@ -72,13 +77,42 @@ namespace ngraph
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
+                /// \brief Selects the thread pool that functions compiled afterwards run on.
+                ///
+                /// thread_pool is "shared" (the default) for the process-wide pool sized by
+                /// OMP_NUM_THREADS or NGRAPH_INTRA_OP_PARALLELISM, "backend" for a pool owned by
+                /// this backend or "executable" for a pool per compiled function. The other
+                /// keys configure the owned pools: intra_op_threads sets their size,
+                /// cpu_affinity pins them to a cpu list such as "0-3,8", numa_node pins them to
+                /// the cpus of a NUMA node and wait_policy is "spin_then_sleep" (the default) or
+                /// "sleep". cpu_affinity and numa_node are exclusive. Without intra_op_threads or
+                /// cpus an executable pool has one thread and a backend pool one per core.
+                /// Owned pools only apply to direct execution.
+                ///
+                /// MKLDNN primitives run on the OpenMP threads, which these keys neither size
+                /// nor pin; use OMP_NUM_THREADS and KMP_AFFINITY or OMP_PLACES for those.
+                bool set_config(const std::map<std::string, std::string>& config,
+                                std::string& error) override;
+
             private:
+                enum class ThreadPoolScope
+                {
+                    Shared,
+                    Backend,
+                    Executable
+                };
+
                 // this mutex will be used to protect the addition and deletion
                 // of function to m_exec_map across multiple threads
                 std::mutex m_exec_map_mutex;
                 std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<Executable>>
                     m_exec_map;
                 Allocator* m_allocator;
+
+                ThreadPoolScope m_thread_pool_scope = ThreadPoolScope::Shared;
+                std::shared_ptr<executor::ThreadPoolConfig> m_thread_pool_config;
+                // The pool of the Backend scope, created by the first compile that needs it
+                std::shared_ptr<executor::DedicatedThreadPool> m_thread_pool;
             };
         }
     }
@@ -41,6 +41,7 @@ namespace ngraph
                 register_builders_dropout_cpp();
                 register_builders_embedding_lookup_cpp();
                 register_builders_erf_cpp();
+                register_builders_fused_elementwise_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
                 register_builders_gelu_cpp();
@@ -40,6 +40,7 @@ namespace ngraph
             void register_builders_dropout_cpp();
             void register_builders_embedding_lookup_cpp();
             void register_builders_erf_cpp();
+            void register_builders_fused_elementwise_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
             void register_builders_gelu_cpp();
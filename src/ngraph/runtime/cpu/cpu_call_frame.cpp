@@ -122,31 +122,75 @@ void runtime::cpu::CPU_CallFrame::call(
 {
     size_t id = 0;
     auto disable_caching = false;
+    auto create_ctx = false;
+    std::vector<mkldnn::primitive*> primitives;
     {
         std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
+        while (m_num_ctx_available == 0 && m_ctx_vec.size() + m_num_ctx_pending == m_num_ctx)
         {
             m_cv.wait(lck);
         }
 
-        for (size_t i = 0; i < m_num_ctx; i++)
+        if (m_num_ctx_available == 0)
         {
-            if (m_id_pool[i])
+            // All contexts are busy but the limit is not reached yet, so this call gets a new
+            // one. It is created outside of the lock so that other calls can proceed.
+            create_ctx = true;
+            m_num_ctx_pending++;
+            if (m_primitives_shared)
             {
-                id = i;
-                break;
+                primitives = m_shared_primitives;
             }
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        else
+        {
+            id = m_ctx_vec.size();
+            for (size_t i = 0; i < m_ctx_vec.size(); i++)
+            {
+                if (m_id_pool[i])
+                {
+                    id = i;
+                    break;
+                }
+            }
+            NGRAPH_CHECK(id != m_ctx_vec.size());
+            m_id_pool[id] = false;
+            if (id != m_prev_ctx)
+            {
+                // Disable caching since staleness hints are no longer
+                // applicable to this context
+                disable_caching = true;
+            }
+            m_prev_ctx = id;
+            m_num_ctx_available--;
+        }
+    }
+
+    if (create_ctx)
+    {
+        CPURuntimeContext* ctx = nullptr;
+        try
+        {
+            ctx = create_runtime_context(primitives);
+        }
+        catch (...)
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            m_mutex.lock();
+            m_num_ctx_pending--;
+            m_mutex.unlock();
+            m_cv.notify_one();
+            throw;
         }
+
+        // m_ctx_vec has its capacity reserved up front, so appending does not move the
+        // contexts other calls are using
+        std::lock_guard<std::mutex> lck(m_mutex);
+        id = m_ctx_vec.size();
+        m_ctx_vec.push_back(ctx);
+        m_id_pool[id] = false;
+        m_num_ctx_pending--;
+        disable_caching = true;
         m_prev_ctx = id;
-        m_num_ctx_available--;
     }
 
     m_ctx_vec[id]->pc = 0;
@@ -154,6 +198,11 @@ void runtime::cpu::CPU_CallFrame::call(
     inner_call(output_tvs, input_tvs, id, disable_caching);
 
     m_mutex.lock();
+    if (!m_primitives_shared && !m_ctx_vec[id]->first_iteration)
+    {
+        m_shared_primitives = m_ctx_vec[id]->mkldnn_primitives;
+        m_primitives_shared = true;
+    }
     m_id_pool[id] = true;
     m_num_ctx_available++;
     m_mutex.unlock();
@@ -180,128 +229,170 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
+size_t runtime::cpu::CPU_CallFrame::get_num_contexts()
+{
+    std::unique_lock<std::mutex> lck(m_mutex);
+    return m_ctx_vec.size();
+}
+
+std::vector<mkldnn::primitive*> runtime::cpu::CPU_CallFrame::get_context_primitives(size_t index)
+{
+    std::unique_lock<std::mutex> lck(m_mutex);
+    NGRAPH_CHECK(index < m_ctx_vec.size(), "No runtime context ", index);
+    return m_ctx_vec[index]->mkldnn_primitives;
+}
+
 void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
-    {
-        m_id_pool[i] = true;
-        auto ctx = new CPURuntimeContext;
-        m_ctx_vec.push_back(ctx);
+    m_allocator = allocator;
+    // Only the first context is created here, the debugger and codegen rely on it.
+    // Further contexts are created by call() once concurrent calls need them.
+    m_ctx_vec.reserve(m_num_ctx);
+    m_ctx_vec.push_back(create_runtime_context({}));
+    m_id_pool[0] = true;
+    m_num_ctx_available = 1;
+}
 
-        ctx->pc = 0;
-        ctx->op_durations = nullptr;
-        if (runtime::cpu::IsTracingEnabled())
-        {
-            ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
-        }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::create_runtime_context(
+    const std::vector<mkldnn::primitive*>& primitives)
+{
+    auto ctx = new CPURuntimeContext;
 
-        ctx->first_iteration = true;
+    ctx->pc = 0;
+    ctx->op_durations = nullptr;
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+    }
+    ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
 
-        ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+    ctx->first_iteration = true;
 
-        // Create temporary buffer pools
-        size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
-        {
-            auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
-            ctx->memory_buffers.push_back(buffer);
-        }
-        const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
-        // Create scratchpad
-        auto scratchpad_size = mkldnn_emitter->get_max_scratchpad_size();
-        if (m_external_function->is_direct_execution())
+    ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+
+    // Create temporary buffer pools
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    {
+        auto buffer = new AlignedBuffer(buffer_size, alignment, m_allocator);
+        ctx->memory_buffers.push_back(buffer);
+    }
+    const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
+    // Create scratchpad
+    auto scratchpad_size = mkldnn_emitter->get_max_scratchpad_size();
+    if (m_external_function->is_direct_execution())
+    {
+        if (primitives.empty())
         {
             ctx->mkldnn_primitives =
                 std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
-            ctx->mkldnn_memories =
-                std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
-            ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
-                mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
-            if (scratchpad_size > 0)
-            {
-                ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
-            }
-            else
-            {
-                ctx->scratchpad_buffer = nullptr;
-            }
         }
         else
         {
-            // single thread for codegen
-            NGRAPH_CHECK(m_num_ctx == 1);
+            ctx->mkldnn_primitives = primitives;
         }
-
-        ctx->states = m_external_function->m_states.data();
-#if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
+        ctx->mkldnn_memories =
+            std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
+        ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
+            mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
+        if (scratchpad_size > 0)
         {
-            // For codegen mode, graph and global control are now part of the code generated
-            // CPURuntimeContextCG class.
-            ctx->G = new tbb::flow::graph;
-            const auto envParallelism = getenv_int("NGRAPH_INTER_OP_PARALLELISM");
-            const auto parallelism = envParallelism <= 0 ? 1 : envParallelism;
-            ctx->c =
-                new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
+            ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, m_allocator);
         }
-#endif
+        else
+        {
+            ctx->scratchpad_buffer = nullptr;
+        }
+    }
+    else
+    {
+        // single thread for codegen
+        NGRAPH_CHECK(m_num_ctx == 1);
+    }
+
+    ctx->states = m_external_function->m_states.data();
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
+    {
+        // For codegen mode, graph and global control are now part of the code generated
+        // CPURuntimeContextCG class.
+        ctx->G = new tbb::flow::graph;
+        const auto envParallelism = getenv_int("NGRAPH_INTER_OP_PARALLELISM");
+        const auto parallelism = envParallelism <= 0 ? 1 : envParallelism;
+        ctx->c =
+            new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
     }
-    m_num_ctx_available = m_num_ctx;
+#endif
+    return ctx;
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
+    while (!m_ctx_vec.empty())
     {
-        auto ctx = m_ctx_vec.back();
+        destroy_runtime_context(m_ctx_vec.back());
         m_ctx_vec.pop_back();
+    }
+    for (auto p : m_shared_primitives)
+    {
+        delete p;
+    }
+    m_shared_primitives.clear();
+    m_primitives_shared = false;
+    m_id_pool.clear();
+    m_num_ctx_available = 0;
+}
 
-        delete[] ctx->op_durations;
-        delete[] ctx->p_en;
-        for (auto p : ctx->mkldnn_primitives)
+void runtime::cpu::CPU_CallFrame::destroy_runtime_context(CPURuntimeContext* ctx)
+{
+    delete[] ctx->op_durations;
+    delete[] ctx->p_en;
+    for (size_t i = 0; i < ctx->mkldnn_primitives.size(); i++)
+    {
+        // Shared primitives are released once by cleanup_runtime_context
+        auto p = ctx->mkldnn_primitives[i];
+        if (i >= m_shared_primitives.size() || p != m_shared_primitives[i])
         {
             delete p;
         }
-        for (auto m : ctx->mkldnn_memories)
-        {
-            delete m;
-        }
-        for (auto buffer : ctx->memory_buffers)
-        {
-            delete buffer;
-        }
-        for (auto s : ctx->mkldnn_scratchpad_mds)
-        {
-            delete s;
-        }
-        if (m_external_function->is_direct_execution())
-        {
-            delete ctx->scratchpad_buffer;
-        }
+    }
+    for (auto m : ctx->mkldnn_memories)
+    {
+        delete m;
+    }
+    for (auto buffer : ctx->memory_buffers)
+    {
+        delete buffer;
+    }
+    for (auto s : ctx->mkldnn_scratchpad_mds)
+    {
+        delete s;
+    }
+    if (m_external_function->is_direct_execution())
+    {
+        delete ctx->scratchpad_buffer;
+    }
 
 #if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
-        {
-            // For codegen mode, graph and global control are now part of a code generated
-            // CPURuntimeContext class.
+    if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
+    {
+        // For codegen mode, graph and global control are now part of a code generated
+        // CPURuntimeContext class.
 
-            // delete graph G and nodes in G
-            ctx->G->wait_for_all();
-            std::vector<tbb::flow::graph_node*> to_be_deleted;
-            for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
-            {
-                to_be_deleted.push_back(&(*it));
-            }
-            delete ctx->G;
-            for (auto node : to_be_deleted)
-            {
-                delete node;
-            }
-            delete ctx->c;
+        // delete graph G and nodes in G
+        ctx->G->wait_for_all();
+        std::vector<tbb::flow::graph_node*> to_be_deleted;
+        for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
+        {
+            to_be_deleted.push_back(&(*it));
         }
-#endif
-        delete ctx;
+        delete ctx->G;
+        for (auto node : to_be_deleted)
+        {
+            delete node;
+        }
+        delete ctx->c;
     }
-    m_num_ctx_available = 0;
+#endif
+    delete ctx;
 }
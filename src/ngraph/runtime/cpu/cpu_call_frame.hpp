@@ -73,6 +73,11 @@ namespace ngraph
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
+                /// \returns Number of runtime contexts created so far
+                size_t get_num_contexts();
+                /// \brief The mkldnn primitives of a runtime context, to be read between calls
+                std::vector<mkldnn::primitive*> get_context_primitives(size_t index);
+
                 void setup_runtime_context(runtime::Allocator* allocator);
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
@@ -87,6 +92,10 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                CPURuntimeContext*
+                    create_runtime_context(const std::vector<mkldnn::primitive*>& primitives);
+                void destroy_runtime_context(CPURuntimeContext* ctx);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
                 std::mutex m_mutex;
@@ -94,8 +103,17 @@ namespace ngraph
                 volatile size_t m_num_ctx_available = 0;
                 size_t m_prev_ctx = 0;
                 size_t m_num_ctx = 1;
+                /// Contexts beyond the first are created on demand, up to m_num_ctx.
+                size_t m_num_ctx_pending = 0;
                 std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
+                runtime::Allocator* m_allocator = nullptr;
+
+                /// Primitives built by the first context to complete a call. Contexts created
+                /// later start out with them instead of building their own; the memories and
+                /// scratchpad they execute against stay per context.
+                std::vector<mkldnn::primitive*> m_shared_primitives;
+                bool m_primitives_shared = false;
 
                 // Codegen specific
 
@@ -28,6 +28,7 @@
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
@@ -41,16 +42,23 @@
 using namespace ngraph;
 using namespace std;
 
-runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
-                                             ngraph::pass::PassConfig& pass_config,
-                                             Allocator* allocator,
-                                             bool performance_counters_enabled)
+runtime::cpu::CPU_Executable::CPU_Executable(
+    shared_ptr<Function> func,
+    ngraph::pass::PassConfig& pass_config,
+    Allocator* allocator,
+    bool performance_counters_enabled,
+    shared_ptr<executor::DedicatedThreadPool> thread_pool)
 {
     FunctionInstance& instance = m_function_instance;
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
+        if (thread_pool)
+        {
+            instance.m_thread_pool = thread_pool;
+            instance.m_external_function->m_arena = thread_pool->get_arena();
+        }
         auto cf = instance.m_external_function->make_call_frame(pass_config, allocator);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
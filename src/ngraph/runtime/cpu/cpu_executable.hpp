@@ -33,18 +33,31 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            namespace executor
+            {
+                class DedicatedThreadPool;
+            }
 
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
             {
             public:
-                CPU_Executable(std::shared_ptr<Function> func,
-                               ngraph::pass::PassConfig& pass_config,
-                               Allocator* allocator,
-                               bool performance_counters_enabled);
+                /// \param thread_pool Pool to run kernels on, nullptr for the process-wide pool
+                CPU_Executable(
+                    std::shared_ptr<Function> func,
+                    ngraph::pass::PassConfig& pass_config,
+                    Allocator* allocator,
+                    bool performance_counters_enabled,
+                    std::shared_ptr<executor::DedicatedThreadPool> thread_pool = nullptr);
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
+                /// \brief The pool the executable runs kernels on, nullptr for the process-wide
+                ///        pool
+                std::shared_ptr<executor::DedicatedThreadPool> get_thread_pool() const
+                {
+                    return m_function_instance.m_thread_pool;
+                }
 
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
@@ -80,6 +93,8 @@ namespace ngraph
                 class FunctionInstance
                 {
                 public:
+                    // Declared first so that it outlives the call frame running on it
+                    std::shared_ptr<executor::DedicatedThreadPool> m_thread_pool = nullptr;
                     std::shared_ptr<CPU_ExternalFunction> m_external_function = nullptr;
                     std::shared_ptr<CPU_CallFrame> m_call_frame = nullptr;
                     bool m_performance_counters_enabled = false;
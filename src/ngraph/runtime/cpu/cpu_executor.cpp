@@ -14,12 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <fstream>
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "cpu_executor.hpp"
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/util.hpp"
 
 #define MAX_PARALLELISM_THRESHOLD 2
 
@@ -68,6 +75,39 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+// Eigen's default thread environment, except that new threads are pinned to a cpu set
+class PinnedThreadEnvironment : public Eigen::StlThreadEnvironment
+{
+public:
+    PinnedThreadEnvironment(const std::vector<int>& cpus)
+        : m_cpus(cpus)
+    {
+    }
+
+    EnvThread* CreateThread(std::function<void()> f)
+    {
+        auto cpus = m_cpus;
+        return new EnvThread([cpus, f]() {
+#if defined(__linux__)
+            if (!cpus.empty())
+            {
+                cpu_set_t cpu_set;
+                CPU_ZERO(&cpu_set);
+                for (int cpu : cpus)
+                {
+                    CPU_SET(cpu, &cpu_set);
+                }
+                pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+            }
+#endif
+            f();
+        });
+    }
+
+private:
+    std::vector<int> m_cpus;
+};
+
 namespace ngraph
 {
     namespace runtime
@@ -76,6 +116,50 @@ namespace ngraph
         {
             namespace executor
             {
+                std::vector<int> parse_cpu_list(const std::string& cpu_list)
+                {
+                    std::vector<int> cpus;
+                    for (const std::string& range : split(cpu_list, ',', true))
+                    {
+                        if (range.empty())
+                        {
+                            continue;
+                        }
+                        auto bounds = split(range, '-', true);
+                        int first = -1;
+                        int last = -1;
+                        try
+                        {
+                            first = parse_string<int>(bounds.front());
+                            last = parse_string<int>(bounds.back());
+                        }
+                        catch (const std::exception&)
+                        {
+                        }
+                        if (bounds.size() > 2 || first < 0 || last < first)
+                        {
+                            throw ngraph_error("Invalid cpu list '" + cpu_list + "'");
+                        }
+                        for (int cpu = first; cpu <= last; cpu++)
+                        {
+                            cpus.push_back(cpu);
+                        }
+                    }
+                    return cpus;
+                }
+
+                std::vector<int> get_numa_node_cpus(int node)
+                {
+                    std::ifstream cpu_list_file("/sys/devices/system/node/node" +
+                                                std::to_string(node) + "/cpulist");
+                    std::string cpu_list;
+                    if (!std::getline(cpu_list_file, cpu_list))
+                    {
+                        return {};
+                    }
+                    return parse_cpu_list(cpu_list);
+                }
+
                 CPUExecutor::CPUExecutor(int num_thread_pools)
                     : m_num_thread_pools(num_thread_pools)
                 {
@@ -106,15 +190,110 @@ namespace ngraph
                             num_threads_per_pool = tp_count;
                         }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
-                        m_thread_pool_devices.push_back(
-                            std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
-                                m_thread_pools[i].get(), num_threads_per_pool)));
+                        std::unique_ptr<Eigen::ThreadPoolInterface> pool(
+                            new Eigen::ThreadPool(num_threads_per_pool));
+                        std::unique_ptr<Eigen::ThreadPoolDevice> device(
+                            new Eigen::ThreadPoolDevice(pool.get(), num_threads_per_pool));
+                        add_slot(std::move(pool), std::move(device));
+                    }
+                }
+
+                int CPUExecutor::add_slot(std::unique_ptr<Eigen::ThreadPoolInterface> pool,
+                                          std::unique_ptr<Eigen::ThreadPoolDevice> device)
+                {
+                    size_t chunk = m_num_slots / SLOTS_PER_CHUNK;
+                    if (chunk == MAX_SLOT_CHUNKS)
+                    {
+                        throw ngraph_error("Cannot create more than " +
+                                           std::to_string(MAX_SLOT_CHUNKS * SLOTS_PER_CHUNK) +
+                                           " thread pools");
+                    }
+                    if (!m_slot_chunks[chunk])
+                    {
+                        m_slot_chunks[chunk].reset(new ThreadPoolSlot[SLOTS_PER_CHUNK]);
+                    }
+                    int arena = static_cast<int>(m_num_slots);
+                    ThreadPoolSlot& slot = get_slot(arena);
+                    slot.pool = std::move(pool);
+                    slot.device = std::move(device);
 #if defined(NGRAPH_TBB_ENABLE)
-                        m_tbb_arenas.emplace_back(1);
+                    slot.tbb_arena.reset(new tbb::task_arena(1));
+#endif
+                    m_num_slots++;
+                    return arena;
+                }
+
+                int CPUExecutor::create_thread_pool(const ThreadPoolConfig& config)
+                {
+#if defined(__linux__)
+                    cpu_set_t allowed;
+                    CPU_ZERO(&allowed);
+                    sched_getaffinity(0, sizeof(allowed), &allowed);
+                    for (int cpu : config.cpus)
+                    {
+                        if (cpu < 0 || cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed))
+                        {
+                            throw ngraph_error("Cannot pin a thread pool to cpu " +
+                                               std::to_string(cpu) +
+                                               ", the process may not run on it");
+                        }
+                    }
 #endif
+                    int num_threads = config.num_threads;
+                    if (num_threads < 1)
+                    {
+                        num_threads = config.cpus.empty() ? m_num_cores
+                                                          : static_cast<int>(config.cpus.size());
+                    }
+                    int max_parallelism_allowed =
+                        MAX_PARALLELISM_THRESHOLD * std::thread::hardware_concurrency();
+                    if (num_threads > max_parallelism_allowed)
+                    {
+                        throw ngraph_error("Thread pool size " + std::to_string(num_threads) +
+                                           " is too high. Please specify a value in range [1-" +
+                                           std::to_string(max_parallelism_allowed) + "]");
+                    }
+
+                    std::unique_ptr<Eigen::ThreadPoolInterface> pool(
+                        new Eigen::ThreadPoolTempl<PinnedThreadEnvironment>(
+                            num_threads,
+                            config.wait_policy == WaitPolicy::SpinThenSleep,
+                            PinnedThreadEnvironment(config.cpus)));
+                    std::unique_ptr<Eigen::ThreadPoolDevice> device(
+                        new Eigen::ThreadPoolDevice(pool.get(), num_threads));
+
+                    std::lock_guard<std::mutex> lock(m_thread_pools_mutex);
+                    // Reuse a released slot before growing
+                    for (int arena = m_num_thread_pools; arena < static_cast<int>(m_num_slots);
+                         arena++)
+                    {
+                        ThreadPoolSlot& slot = get_slot(arena);
+                        if (!slot.pool)
+                        {
+                            slot.pool = std::move(pool);
+                            slot.device = std::move(device);
+                            return arena;
+                        }
+                    }
+                    return add_slot(std::move(pool), std::move(device));
+                }
+
+                void CPUExecutor::release_thread_pool(int arena)
+                {
+                    std::unique_ptr<Eigen::ThreadPoolInterface> pool;
+                    std::unique_ptr<Eigen::ThreadPoolDevice> device;
+                    {
+                        std::lock_guard<std::mutex> lock(m_thread_pools_mutex);
+                        if (arena < m_num_thread_pools ||
+                            arena >= static_cast<int>(m_num_slots) || !get_slot(arena).pool)
+                        {
+                            throw ngraph_error("Thread pool " + std::to_string(arena) +
+                                               " was not created by create_thread_pool");
+                        }
+                        device = std::move(get_slot(arena).device);
+                        pool = std::move(get_slot(arena).pool);
                     }
+                    // Joining the pool threads happens outside the lock
                 }
 
 #if defined(NGRAPH_TBB_ENABLE)
@@ -126,7 +305,7 @@ namespace ngraph
                     auto tbb_functor = [&]() { f(ctx, ectx); };
                     if (use_tbb)
                     {
-                        m_tbb_arenas[ectx->arena].execute(tbb_functor);
+                        get_slot(ectx->arena).tbb_arena->execute(tbb_functor);
                     }
                     else
                     {
@@ -149,6 +328,17 @@ namespace ngraph
                     return cpu_executor;
                 }
                 mkldnn::engine global_cpu_engine(mkldnn::engine::kind::cpu, 0);
+
+                DedicatedThreadPool::DedicatedThreadPool(const ThreadPoolConfig& config)
+                    : m_config(config)
+                    , m_arena(GetCPUExecutor().create_thread_pool(config))
+                {
+                }
+
+                DedicatedThreadPool::~DedicatedThreadPool()
+                {
+                    GetCPUExecutor().release_thread_pool(m_arena);
+                }
             }
         }
     }
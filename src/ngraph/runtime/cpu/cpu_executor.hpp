@@ -17,7 +17,10 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <mkldnn.hpp>
 
@@ -40,16 +43,42 @@ namespace ngraph
             {
                 extern mkldnn::engine global_cpu_engine;
 
+                // How idle pool threads wait for work. SpinThenSleep keeps polling for a
+                // while before blocking, which trades cpu time for wake-up latency.
+                enum class WaitPolicy
+                {
+                    SpinThenSleep,
+                    Sleep
+                };
+
+                struct ThreadPoolConfig
+                {
+                    // 0 uses the number of cpus, or the process default without cpus
+                    int num_threads = 0;
+                    // Pool threads may only run on these cpus, empty leaves them unpinned
+                    std::vector<int> cpus;
+                    WaitPolicy wait_policy = WaitPolicy::SpinThenSleep;
+                };
+
+                // Parses a Linux cpu list such as "0-3,8,10-11"
+                std::vector<int> parse_cpu_list(const std::string& cpu_list);
+                // Returns the cpus of a NUMA node, empty if the node does not exist
+                std::vector<int> get_numa_node_cpus(int node);
+
                 // CPUExecutor owns the resources for executing a graph.
                 class CPUExecutor
                 {
                 public:
                     explicit CPUExecutor(int num_thread_pools);
 
-                    Eigen::ThreadPoolDevice& get_device(int id)
-                    {
-                        return *m_thread_pool_devices[id].get();
-                    }
+                    Eigen::ThreadPoolDevice& get_device(int id) { return *get_slot(id).device; }
+
+                    // Creates a pool besides the process-wide ones and returns the arena a
+                    // CPUExecutionContext uses to run kernels on it
+                    int create_thread_pool(const ThreadPoolConfig& config);
+                    // Destroys a pool made by create_thread_pool. No kernel may still be
+                    // running on it.
+                    void release_thread_pool(int arena);
 
 #if defined(NGRAPH_TBB_ENABLE)
                     void execute(CPUKernelFunctor& f,
@@ -64,16 +93,52 @@ namespace ngraph
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
-                    std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
+                    struct ThreadPoolSlot
+                    {
+                        std::unique_ptr<Eigen::ThreadPoolInterface> pool;
+                        std::unique_ptr<Eigen::ThreadPoolDevice> device;
 #if defined(NGRAPH_TBB_ENABLE)
-                    std::vector<tbb::task_arena> m_tbb_arenas;
+                        std::unique_ptr<tbb::task_arena> tbb_arena;
 #endif
+                    };
+                    static const size_t SLOTS_PER_CHUNK = 64;
+                    static const size_t MAX_SLOT_CHUNKS = 1024;
+
+                    ThreadPoolSlot& get_slot(int arena)
+                    {
+                        return m_slot_chunks[arena / SLOTS_PER_CHUNK][arena % SLOTS_PER_CHUNK];
+                    }
+                    // Appends a slot, guarded by m_thread_pools_mutex
+                    int add_slot(std::unique_ptr<Eigen::ThreadPoolInterface> pool,
+                                 std::unique_ptr<Eigen::ThreadPoolDevice> device);
+
+                    // Slots live in chunks that never move, so kernels look up their device
+                    // without the lock while other pools are created and released
+                    std::unique_ptr<ThreadPoolSlot[]> m_slot_chunks[MAX_SLOT_CHUNKS];
+                    size_t m_num_slots = 0;
+                    std::mutex m_thread_pools_mutex;
                     int m_num_thread_pools;
                     int m_num_cores;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
+
+                // A pool of its own for a backend or an executable, released with the last
+                // reference
+                class DedicatedThreadPool
+                {
+                public:
+                    explicit DedicatedThreadPool(const ThreadPoolConfig& config);
+                    ~DedicatedThreadPool();
+                    DedicatedThreadPool(const DedicatedThreadPool&) = delete;
+                    DedicatedThreadPool& operator=(const DedicatedThreadPool&) = delete;
+
+                    int get_arena() const { return m_arena; }
+                    const ThreadPoolConfig& get_config() const { return m_config; }
+                private:
+                    ThreadPoolConfig m_config;
+                    int m_arena;
+                };
             }
         }
     }
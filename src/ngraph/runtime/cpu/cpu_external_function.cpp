@@ -14,8 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -197,6 +199,7 @@
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
@@ -244,6 +247,7 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     : m_function(function)
     , m_release_function(release_function)
     , m_emit_timing(false)
+    , m_arena(0)
 #if defined(NGRAPH_TBB_ENABLE)
     , m_use_tbb(getenv_bool("NGRAPH_CPU_USE_TBB"))
 #endif
@@ -1294,6 +1298,21 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
 #endif
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
+    // FusedElementwise only has a DEX builder. It runs ahead of CPUCollapseDims so that the
+    // broadcasts it absorbs are still in their original form. Off until its kernel has been
+    // validated against the backend suites, NGRAPH_PASS_ENABLES="CPUElementwiseFusion:1"
+    // turns it on.
+    if (dex)
+    {
+#ifdef NGRAPH_MLIR_ENABLE
+        if (!getenv_bool("NGRAPH_MLIR"))
+        {
+#endif
+            REGISTER_KNOBBED_PASS(CPUElementwiseFusion, false, runtime::cpu::pass)
+#ifdef NGRAPH_MLIR_ENABLE
+        }
+#endif
+    }
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
 
 #ifdef NGRAPH_MLIR_ENABLE
@@ -1318,8 +1337,16 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
+    auto allocation_scheme =
+        pass_config.get_pass_attribute("CPUMemoryAssignment::OfflinePlanning")
+            ? ngraph::pass::MemoryManager::allocation_scheme::GREEDY_BY_SIZE
+            : ngraph::pass::MemoryManager::allocation_scheme::FIRST_FIT;
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
-        bufferID_to_tensorSets, tensor_to_bufferID, size_t(s_memory_pool_alignment), !reuse_memory);
+        bufferID_to_tensorSets,
+        tensor_to_bufferID,
+        size_t(s_memory_pool_alignment),
+        !reuse_memory,
+        allocation_scheme);
 
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
@@ -1338,6 +1365,119 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+void runtime::cpu::CPU_ExternalFunction::share_constant_derived_tensors(
+    const vector<Node*>& op_nodes, unordered_set<Node*>& constant_derived)
+{
+    unordered_map<descriptor::Tensor*, Node*> producers;
+    for (Node* node : op_nodes)
+    {
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            producers[&node->get_output_tensor(i)] = node;
+        }
+    }
+
+    // An output can be shared only if every tensor in its buffer set is shared as well, since
+    // they use the same memory. Dropping an op may in turn drop the ops reading it.
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (Node* node : op_nodes)
+        {
+            if (constant_derived.count(node) == 0)
+            {
+                continue;
+            }
+            bool shared = true;
+            for (auto& value : node->input_values())
+            {
+                auto producer = value.get_node();
+                shared = shared && (producer->is_constant() || constant_derived.count(producer));
+            }
+            for (size_t i = 0; i < node->get_output_size() && shared; i++)
+            {
+                auto& buffer_set = bufferID_to_tensorSets.at(
+                    tensor_to_bufferID.at(&node->get_output_tensor(i)));
+                shared = buffer_set.first == TensorRole::INTERMEDIATE;
+                for (auto tensor : buffer_set.second)
+                {
+                    auto it = producers.find(tensor);
+                    shared = shared && it != producers.end() && constant_derived.count(it->second);
+                }
+            }
+            if (!shared)
+            {
+                constant_derived.erase(node);
+                changed = true;
+            }
+        }
+    }
+
+    m_constant_derived_ops.assign(op_nodes.size(), false);
+    size_t shared_begin = numeric_limits<size_t>::max();
+    size_t shared_end = 0;
+    size_t pool_end = 0;
+    for (Node* node : op_nodes)
+    {
+        bool shared = constant_derived.count(node) != 0;
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            auto tensor = &node->get_output_tensor(i);
+            auto it = tensor_to_bufferID.find(tensor);
+            if (it == tensor_to_bufferID.end() ||
+                bufferID_to_tensorSets.at(it->second).first != TensorRole::INTERMEDIATE)
+            {
+                continue;
+            }
+            size_t offset = tensor->get_pool_offset();
+            if (shared)
+            {
+                shared_begin = min(shared_begin, offset);
+                shared_end = max(shared_end, offset + tensor->size());
+            }
+            else
+            {
+                pool_end = max(pool_end, offset + tensor->size());
+            }
+        }
+    }
+    if (m_memory_buffer_sizes.empty() || shared_end == 0)
+    {
+        return;
+    }
+    for (size_t i = 0; i < op_nodes.size(); i++)
+    {
+        m_constant_derived_ops[i] = constant_derived.count(op_nodes[i]) != 0;
+    }
+
+    m_constant_derived_buffer.reset(
+        new AlignedBuffer(shared_end - shared_begin, s_memory_pool_alignment));
+    auto base = static_cast<uint8_t*>(m_constant_derived_buffer->get_ptr());
+    for (size_t i = 0; i < op_nodes.size(); i++)
+    {
+        if (!m_constant_derived_ops[i])
+        {
+            continue;
+        }
+        for (size_t j = 0; j < op_nodes[i]->get_output_size(); j++)
+        {
+            auto tensor = &op_nodes[i]->get_output_tensor(j);
+            constant_derived_tensor_data.emplace_back(
+                m_buffer_indices.at(tensor->get_name()),
+                base + tensor->get_pool_offset() - shared_begin);
+        }
+    }
+    // When memory is reused, cacheable tensors are placed after all others in the pool, so
+    // once they are shared the contexts no longer reserve memory for them
+    if (pool_end <= shared_begin)
+    {
+        m_memory_buffer_sizes[0] = pool_end;
+    }
+    NGRAPH_DEBUG << "CPU_ExternalFunction: " << shared_end - shared_begin
+                 << " bytes of constant derived tensors shared by all contexts";
+}
+
 static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_tracer,
                                       runtime::cpu::TensorTracerAttributes& t_attrs,
                                       const std::string& kernel_name,
@@ -1593,6 +1733,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    // Ops in functor order, and those among them that only read constants directly or through
+    // other such ops
+    vector<Node*> op_nodes;
+    unordered_set<Node*> constant_derived;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1650,6 +1794,25 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
              !cacheable) // Check cacheability only if we are reusing intermediate tensors
             || computes_result(node.get()) || possibly_overwritten(node.get()) || node->has_state();
 
+        op_nodes.push_back(node.get());
+        if (!disable_caching)
+        {
+            bool reads_constants = true;
+            for (auto& value : node->input_values())
+            {
+                auto producer = value.get_node();
+                if (!producer->is_constant() && constant_derived.count(producer) == 0)
+                {
+                    reads_constants = false;
+                    break;
+                }
+            }
+            if (reads_constants)
+            {
+                constant_derived.insert(node.get());
+            }
+        }
+
         vector<reference_wrapper<bool>> in_stale, out_stale;
         for (const auto& name : in_names)
         {
@@ -1775,6 +1938,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // This check ensures we have exactly one functor for Op.
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
 
+    share_constant_derived_tensors(op_nodes, constant_derived);
+
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         cpu::Timestamp start_ts, end_ts;
         uint64_t profiler_count = 0;
@@ -1791,6 +1956,31 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             {
                 ctx->buffer_data[p.first] = p.second;
             }
+
+            for (auto& p : constant_derived_tensor_data)
+            {
+                ctx->buffer_data[p.first] = p.second;
+            }
+
+            // The first context to get here computes the shared tensors, the others wait for
+            // it and then skip those ops. Shared ops only read constants and other shared
+            // tensors, so they can run ahead of the rest in their own order.
+            if (!m_constant_derived_ready.load(memory_order_acquire))
+            {
+                lock_guard<mutex> lock(m_constant_derived_mutex);
+                if (!m_constant_derived_ready.load(memory_order_relaxed))
+                {
+                    for (size_t i = 0; i < functors.size(); i++)
+                    {
+                        if (m_constant_derived_ops[i])
+                        {
+                            CPUExecutionContext ectx{m_arena};
+                            executor::GetCPUExecutor().execute(functors.at(i), ctx, &ectx);
+                        }
+                    }
+                    m_constant_derived_ready.store(true, memory_order_release);
+                }
+            }
         }
 
         for (const auto& p : function_input_index_offset)
@@ -1824,13 +2014,14 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         new tbb::flow::continue_node<tbb::flow::continue_msg>(
                             *(ctx->G),
                             [&, functor, index](const tbb::flow::continue_msg& /* msg */) {
-                                if (p(ctx) || ctx->first_iteration)
+                                if ((p(ctx) || ctx->first_iteration) &&
+                                    !m_constant_derived_ops[index])
                                 {
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    CPUExecutionContext ectx{m_arena};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
@@ -1948,7 +2139,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
-                if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
+                if (((enables.at(ctx->pc))(ctx) || ctx->first_iteration) &&
+                    !m_constant_derived_ops[ctx->pc])
                 {
                     // Each Op will have exactly one functor, start the clock before the exceution
                     // of functor
@@ -1958,7 +2150,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         start_ts = cpu::Clock::now();
                     }
 
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{m_arena};
 
                     if (debug_tracer.tracing_is_enabled())
                     {
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -39,6 +41,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
@@ -201,6 +204,10 @@ namespace ngraph
                                             ngraph::pass::PassConfig& pass_config);
 
                 bool computes_result(Node* node);
+                // Moves the outputs of the constant_derived ops that can be shared out of the
+                // per-context memory pool, see m_constant_derived_buffer
+                void share_constant_derived_tensors(const std::vector<Node*>& op_nodes,
+                                                    std::unordered_set<Node*>& constant_derived);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
@@ -241,6 +248,8 @@ namespace ngraph
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_release_function;
                 bool m_emit_timing;
+                // Selects the executor thread pool that DEX kernels run on
+                int m_arena;
 
 #if defined(NGRAPH_TBB_ENABLE)
                 bool m_use_tbb;
@@ -306,6 +315,17 @@ namespace ngraph
                 // and the tensor pointer.
                 // used to get the address at runtime
                 std::list<std::pair<size_t, void*>> constant_tensor_data;
+                // Ops that only read constants, such as weight reorders, compute the same values
+                // in every runtime context. Their outputs live in m_constant_derived_buffer and
+                // the first context to run computes them once for all contexts.
+                // index into the cpu_runtime_context's buffer_data vector to get such a tensor,
+                // and its address in m_constant_derived_buffer
+                std::list<std::pair<size_t, void*>> constant_derived_tensor_data;
+                // indexed by functor, whether the op computes a shared tensor
+                std::vector<bool> m_constant_derived_ops;
+                std::unique_ptr<AlignedBuffer> m_constant_derived_buffer;
+                std::mutex m_constant_derived_mutex;
+                std::atomic<bool> m_constant_derived_ready{false};
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
                 // input index, offset into the input, and if the input is stale
                 // used to calculate the correct address at runtime
@@ -0,0 +1,293 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <algorithm>
+#include <cmath>
+
+#include "fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+using Opcode = ngraph::op::FusedElementwise::Opcode;
+using InputMode = ngraph::op::FusedElementwise::InputMode;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Floats of scratch per tile, summed over all registers, sized to stay in L1
+                static const size_t s_tile_budget = 4096;
+
+                static void evaluate(Opcode opcode,
+                                     const float* a,
+                                     const float* b,
+                                     const float* c,
+                                     float* out,
+                                     size_t n)
+                {
+                    switch (opcode)
+                    {
+                    case Opcode::Add:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] + b[i];
+                        }
+                        break;
+                    case Opcode::Subtract:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] - b[i];
+                        }
+                        break;
+                    case Opcode::Multiply:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] * b[i];
+                        }
+                        break;
+                    case Opcode::Divide:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] / b[i];
+                        }
+                        break;
+                    case Opcode::Maximum:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] > b[i] ? a[i] : b[i];
+                        }
+                        break;
+                    case Opcode::Minimum:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] < b[i] ? a[i] : b[i];
+                        }
+                        break;
+                    case Opcode::Negative:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = -a[i];
+                        }
+                        break;
+                    case Opcode::Abs:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = std::fabs(a[i]);
+                        }
+                        break;
+                    case Opcode::Exp:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = std::exp(a[i]);
+                        }
+                        break;
+                    case Opcode::Log:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = std::log(a[i]);
+                        }
+                        break;
+                    case Opcode::Sqrt:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = std::sqrt(a[i]);
+                        }
+                        break;
+                    case Opcode::Tanh:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = std::tanh(a[i]);
+                        }
+                        break;
+                    case Opcode::Sigmoid:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = 1.0f / (1.0f + std::exp(-a[i]));
+                        }
+                        break;
+                    case Opcode::Relu:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] > 0.0f ? a[i] : 0.0f;
+                        }
+                        break;
+                    case Opcode::Select:
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            out[i] = a[i] != 0.0f ? b[i] : c[i];
+                        }
+                        break;
+                    }
+                }
+
+                template <typename T>
+                static void stage(InputMode mode,
+                                  const T* input,
+                                  size_t input_count,
+                                  size_t count,
+                                  size_t begin,
+                                  size_t n,
+                                  float* staged)
+                {
+                    switch (mode)
+                    {
+                    case InputMode::Full:
+                        for (size_t k = 0; k < n; k++)
+                        {
+                            staged[k] = input[begin + k];
+                        }
+                        break;
+                    case InputMode::Scalar: std::fill(staged, staged + n, input[0]); break;
+                    case InputMode::Inner:
+                    {
+                        // Copy whole runs of the input, wrapping around at its end
+                        size_t index = begin % input_count;
+                        for (size_t k = 0; k < n;)
+                        {
+                            size_t run = std::min(n - k, input_count - index);
+                            for (size_t j = 0; j < run; j++)
+                            {
+                                staged[k + j] = input[index + j];
+                            }
+                            k += run;
+                            index = 0;
+                        }
+                        break;
+                    }
+                    case InputMode::Outer:
+                    {
+                        // Repeat each input element for a run of the output
+                        size_t repeat = count / input_count;
+                        size_t index = begin / repeat;
+                        size_t offset = begin % repeat;
+                        for (size_t k = 0; k < n; index++)
+                        {
+                            size_t run = std::min(n - k, repeat - offset);
+                            std::fill(staged + k, staged + k + run, float(input[index]));
+                            k += run;
+                            offset = 0;
+                        }
+                        break;
+                    }
+                    }
+                }
+
+                static void stage(InputMode mode,
+                                  const void* input,
+                                  bool boolean_input,
+                                  size_t input_count,
+                                  size_t count,
+                                  size_t begin,
+                                  size_t n,
+                                  float* staged)
+                {
+                    if (boolean_input)
+                    {
+                        stage(mode,
+                              static_cast<const char*>(input),
+                              input_count,
+                              count,
+                              begin,
+                              n,
+                              staged);
+                    }
+                    else
+                    {
+                        stage(mode,
+                              static_cast<const float*>(input),
+                              input_count,
+                              count,
+                              begin,
+                              n,
+                              staged);
+                    }
+                }
+
+                void fused_elementwise(const FusedElementwiseProgram& program,
+                                       const std::vector<void*>& inputs,
+                                       void* output,
+                                       int arena)
+                {
+                    size_t n_inputs = inputs.size();
+                    size_t n_registers = n_inputs + program.program.size();
+                    size_t tile =
+                        std::max<size_t>(64, (s_tile_budget / n_registers) & ~size_t(15));
+                    size_t count = program.count;
+                    size_t n_tiles = (count + tile - 1) / tile;
+                    float* out = static_cast<float*>(output);
+
+                    auto run_tiles = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<float> scratch(n_registers * tile);
+                        std::vector<const float*> registers(n_registers);
+                        for (Eigen::Index t = first; t < last; t++)
+                        {
+                            size_t begin = t * tile;
+                            size_t n = std::min(tile, count - begin);
+                            for (size_t i = 0; i < n_inputs; i++)
+                            {
+                                InputMode mode = program.input_modes[i];
+                                if (mode == InputMode::Full && !program.boolean_inputs[i])
+                                {
+                                    // Read in place
+                                    registers[i] = static_cast<const float*>(inputs[i]) + begin;
+                                    continue;
+                                }
+                                float* staged = &scratch[i * tile];
+                                stage(mode,
+                                      inputs[i],
+                                      program.boolean_inputs[i],
+                                      program.input_counts[i],
+                                      count,
+                                      begin,
+                                      n,
+                                      staged);
+                                registers[i] = staged;
+                            }
+                            for (size_t j = 0; j < program.program.size(); j++)
+                            {
+                                auto& instruction = program.program[j];
+                                float* result = j + 1 == program.program.size()
+                                                    ? out + begin
+                                                    : &scratch[(n_inputs + j) * tile];
+                                evaluate(instruction.opcode,
+                                         registers[instruction.args[0]],
+                                         registers[instruction.args[1]],
+                                         registers[instruction.args[2]],
+                                         result,
+                                         n);
+                                registers[n_inputs + j] = result;
+                            }
+                        }
+                    };
+
+                    // Per tile: every input read once, the output written once, and roughly
+                    // one cycle per instruction and element
+                    Eigen::TensorOpCost cost(sizeof(float) * n_inputs * tile,
+                                             sizeof(float) * tile,
+                                             program.program.size() * tile);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        n_tiles, cost, run_tiles);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// Everything fused_elementwise needs from the op, captured once at build time
+                struct FusedElementwiseProgram
+                {
+                    std::vector<ngraph::op::FusedElementwise::InputMode> input_modes;
+                    std::vector<size_t> input_counts;
+                    // Inputs holding element::boolean values instead of f32
+                    std::vector<bool> boolean_inputs;
+                    std::vector<ngraph::op::FusedElementwise::Instruction> program;
+                    size_t count;
+                };
+
+                /// Evaluates the whole program one tile at a time so that the intermediate
+                /// registers of a tile stay in cache, and runs the tiles in parallel.
+                void fused_elementwise(const FusedElementwiseProgram& program,
+                                       const std::vector<void*>& inputs,
+                                       void* output,
+                                       int arena);
+            }
+        }
+    }
+}
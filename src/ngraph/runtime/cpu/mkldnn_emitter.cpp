@@ -602,7 +602,7 @@ void MKLDNNEmitter::build_quantize_reorder(
 
     mkldnn_scratchpad_mds[quantize_index] =
         new mkldnn::memory::desc(reorder_prim_desc.scratchpad_desc());
-    mkldnn_primitives[quantize_index] = new mkldnn::reorder(reorder_prim_desc);
+    set_primitive<mkldnn::reorder>(mkldnn_primitives, quantize_index, reorder_prim_desc);
 }
 
 void MKLDNNEmitter::build_deconvolutionbias_forward(
@@ -629,7 +629,7 @@ void MKLDNNEmitter::build_deconvolutionbias_forward(
     size_t result_index = deps[3];
     build_memory(mkldnn_memories, deconv_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[deconv_index] = new mkldnn::deconvolution_forward(deconv_pd);
+    set_primitive<mkldnn::deconvolution_forward>(mkldnn_primitives, deconv_index, deconv_pd);
 }
 
 void MKLDNNEmitter::build_convolution_backward_weights_bias(
@@ -659,7 +659,7 @@ void MKLDNNEmitter::build_convolution_backward_weights_bias(
     size_t diff_bias_index = deps[3];
     build_memory(mkldnn_memories, conv_bwd_pd.diff_bias_desc(), diff_bias_index);
 
-    mkldnn_primitives[conv_index] = new mkldnn::convolution_backward_weights(conv_bwd_pd);
+    set_primitive<mkldnn::convolution_backward_weights>(mkldnn_primitives, conv_index, conv_bwd_pd);
 }
 
 void MKLDNNEmitter::build_convolution_backward_weights(
@@ -688,7 +688,7 @@ void MKLDNNEmitter::build_convolution_backward_weights(
     size_t diff_weights_index = deps[2];
     build_memory(mkldnn_memories, conv_bwd_pd.diff_weights_desc(), diff_weights_index);
 
-    mkldnn_primitives[conv_index] = new mkldnn::convolution_backward_weights(conv_bwd_pd);
+    set_primitive<mkldnn::convolution_backward_weights>(mkldnn_primitives, conv_index, conv_bwd_pd);
 }
 
 void MKLDNNEmitter::build_convolution_backward_data(
@@ -717,7 +717,7 @@ void MKLDNNEmitter::build_convolution_backward_data(
     size_t diff_src_index = deps[2];
     build_memory(mkldnn_memories, conv_bwd_pd.diff_src_desc(), diff_src_index);
 
-    mkldnn_primitives[conv_index] = new mkldnn::convolution_backward_data(conv_bwd_pd);
+    set_primitive<mkldnn::convolution_backward_data>(mkldnn_primitives, conv_index, conv_bwd_pd);
 }
 
 void MKLDNNEmitter::build_pooling_forward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -738,7 +738,7 @@ void MKLDNNEmitter::build_pooling_forward(std::vector<mkldnn::memory*>& mkldnn_m
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, pool_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[pool_index] = new mkldnn::pooling_forward(pool_pd);
+    set_primitive<mkldnn::pooling_forward>(mkldnn_primitives, pool_index, pool_pd);
 }
 
 void MKLDNNEmitter::build_pooling_backward(
@@ -764,7 +764,7 @@ void MKLDNNEmitter::build_pooling_backward(
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, pool_bwd_pd.diff_src_desc(), result_index);
 
-    mkldnn_primitives[pool_index] = new mkldnn::pooling_backward(pool_bwd_pd);
+    set_primitive<mkldnn::pooling_backward>(mkldnn_primitives, pool_index, pool_bwd_pd);
 }
 
 void MKLDNNEmitter::build_max_pooling_backward(
@@ -809,9 +809,9 @@ void MKLDNNEmitter::build_max_pooling_backward(
     fdeps[3] = ws_buf_index;
     bdeps[3] = ws_buf_index;
 
-    mkldnn_primitives[fwd_pool_index] = new mkldnn::pooling_forward(pool_fwd_pd);
+    set_primitive<mkldnn::pooling_forward>(mkldnn_primitives, fwd_pool_index, pool_fwd_pd);
 
-    mkldnn_primitives[bwd_pool_index] = new mkldnn::pooling_backward(pool_bwd_pd);
+    set_primitive<mkldnn::pooling_backward>(mkldnn_primitives, bwd_pool_index, pool_bwd_pd);
 }
 
 void MKLDNNEmitter::build_max_pooling_with_indices_forward(
@@ -836,7 +836,7 @@ void MKLDNNEmitter::build_max_pooling_with_indices_forward(
     size_t ws_index = deps[2];
     build_memory(mkldnn_memories, pool_pd.workspace_desc(), ws_index);
 
-    mkldnn_primitives[max_pool_index] = new mkldnn::pooling_forward(pool_pd);
+    set_primitive<mkldnn::pooling_forward>(mkldnn_primitives, max_pool_index, pool_pd);
 }
 
 void MKLDNNEmitter::build_max_pooling_with_indices_backward(
@@ -865,7 +865,7 @@ void MKLDNNEmitter::build_max_pooling_with_indices_backward(
     size_t fprop_ws_index = deps[1];
     build_memory(mkldnn_memories, pool_fwd_pd.workspace_desc(), fprop_ws_index);
 
-    mkldnn_primitives[max_pool_index] = new mkldnn::pooling_backward(pool_bwd_pd);
+    set_primitive<mkldnn::pooling_backward>(mkldnn_primitives, max_pool_index, pool_bwd_pd);
 }
 
 void MKLDNNEmitter::build_reorder(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -886,7 +886,7 @@ void MKLDNNEmitter::build_reorder(std::vector<mkldnn::memory*>& mkldnn_memories,
     auto reorder_pd = mkldnn::reorder::primitive_desc(
         *mkldnn_memories[input_index], *mkldnn_memories[result_index], attr);
     mkldnn_scratchpad_mds[reorder_index] = new mkldnn::memory::desc(reorder_pd.scratchpad_desc());
-    mkldnn_primitives[reorder_index] = new mkldnn::reorder(reorder_pd);
+    set_primitive<mkldnn::reorder>(mkldnn_primitives, reorder_index, reorder_pd);
 }
 
 void MKLDNNEmitter::build_lrn_forward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -906,7 +906,7 @@ void MKLDNNEmitter::build_lrn_forward(std::vector<mkldnn::memory*>& mkldnn_memor
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, lrn_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[lrn_index] = new mkldnn::lrn_forward(lrn_pd);
+    set_primitive<mkldnn::lrn_forward>(mkldnn_primitives, lrn_index, lrn_pd);
 }
 
 void MKLDNNEmitter::build_relu_forward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -927,7 +927,7 @@ void MKLDNNEmitter::build_relu_forward(std::vector<mkldnn::memory*>& mkldnn_memo
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, relu_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[relu_index] = new mkldnn::eltwise_forward(relu_pd);
+    set_primitive<mkldnn::eltwise_forward>(mkldnn_primitives, relu_index, relu_pd);
 }
 
 void MKLDNNEmitter::build_relu_backward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -956,7 +956,7 @@ void MKLDNNEmitter::build_relu_backward(std::vector<mkldnn::memory*>& mkldnn_mem
     size_t result_index = deps[2];
     build_memory(mkldnn_memories, relu_bwd_pd.diff_src_desc(), result_index);
 
-    mkldnn_primitives[relu_index] = new mkldnn::eltwise_backward(relu_bwd_pd);
+    set_primitive<mkldnn::eltwise_backward>(mkldnn_primitives, relu_index, relu_bwd_pd);
 }
 
 void MKLDNNEmitter::build_sigmoid_forward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -977,7 +977,7 @@ void MKLDNNEmitter::build_sigmoid_forward(std::vector<mkldnn::memory*>& mkldnn_m
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, sigmoid_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[sigmoid_index] = new mkldnn::eltwise_forward(sigmoid_pd);
+    set_primitive<mkldnn::eltwise_forward>(mkldnn_primitives, sigmoid_index, sigmoid_pd);
 }
 
 void MKLDNNEmitter::build_sigmoid_backward(
@@ -1007,7 +1007,7 @@ void MKLDNNEmitter::build_sigmoid_backward(
     size_t result_index = deps[2];
     build_memory(mkldnn_memories, sigmoid_bwd_pd.diff_dst_desc(), result_index);
 
-    mkldnn_primitives[sigmoid_index] = new mkldnn::eltwise_backward(sigmoid_bwd_pd);
+    set_primitive<mkldnn::eltwise_backward>(mkldnn_primitives, sigmoid_index, sigmoid_bwd_pd);
 }
 
 void MKLDNNEmitter::build_elementwise_add(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1027,7 +1027,7 @@ void MKLDNNEmitter::build_elementwise_add(std::vector<mkldnn::memory*>& mkldnn_m
     mkldnn_scratchpad_mds[add_index] = new mkldnn::memory::desc(sum_pd.scratchpad_desc());
 
     // sum primitive
-    mkldnn_primitives[add_index] = new mkldnn::sum(sum_pd);
+    set_primitive<mkldnn::sum>(mkldnn_primitives, add_index, sum_pd);
 }
 
 void MKLDNNEmitter::build_batchnorm_forward(
@@ -1064,7 +1064,8 @@ void MKLDNNEmitter::build_batchnorm_forward(
         size_t variance_index = deps[4];
         build_memory(mkldnn_memories, batchnorm_pd.variance_desc(), variance_index);
 
-        mkldnn_primitives[batchnorm_index] = new mkldnn::batch_normalization_forward(batchnorm_pd);
+        set_primitive<mkldnn::batch_normalization_forward>(
+            mkldnn_primitives, batchnorm_index, batchnorm_pd);
     }
     else
     {
@@ -1077,7 +1078,8 @@ void MKLDNNEmitter::build_batchnorm_forward(
         size_t variance_index = deps[2];
         build_memory(mkldnn_memories, batchnorm_pd.variance_desc(), variance_index);
 
-        mkldnn_primitives[batchnorm_index] = new mkldnn::batch_normalization_forward(batchnorm_pd);
+        set_primitive<mkldnn::batch_normalization_forward>(
+            mkldnn_primitives, batchnorm_index, batchnorm_pd);
     }
 }
 
@@ -1123,7 +1125,8 @@ void MKLDNNEmitter::build_batchnorm_backward(
     size_t dweights_index = deps[6];
     build_memory(mkldnn_memories, dweights_desc, dweights_index);
 
-    mkldnn_primitives[batchnorm_index] = new mkldnn::batch_normalization_backward(batchnorm_pd);
+    set_primitive<mkldnn::batch_normalization_backward>(
+        mkldnn_primitives, batchnorm_index, batchnorm_pd);
 }
 
 void MKLDNNEmitter::build_vanilla_rnn_forward(
@@ -1164,7 +1167,7 @@ void MKLDNNEmitter::build_vanilla_rnn_forward(
     auto workspace_buf_index = insert_workspace(mkldnn_workspaces, workspace);
     deps[8] = workspace_buf_index;
 
-    mkldnn_primitives[rnn_index] = new mkldnn::vanilla_rnn_forward(rnn_layer_prim_desc);
+    set_primitive<mkldnn::vanilla_rnn_forward>(mkldnn_primitives, rnn_index, rnn_layer_prim_desc);
 }
 
 void MKLDNNEmitter::build_rnn_forward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1208,7 +1211,7 @@ void MKLDNNEmitter::build_rnn_forward(std::vector<mkldnn::memory*>& mkldnn_memor
     auto workspace_buf_index = insert_workspace(mkldnn_workspaces, workspace);
     deps[10] = workspace_buf_index;
 
-    mkldnn_primitives[rnn_index] = new mkldnn::lstm_forward(rnn_layer_prim_desc);
+    set_primitive<mkldnn::lstm_forward>(mkldnn_primitives, rnn_index, rnn_layer_prim_desc);
 }
 
 void MKLDNNEmitter::build_concat(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1230,7 +1233,7 @@ void MKLDNNEmitter::build_concat(std::vector<mkldnn::memory*>& mkldnn_memories,
     mkldnn_scratchpad_mds[concat_index] = new mkldnn::memory::desc(concat_pd.scratchpad_desc());
 
     // concat primitive
-    mkldnn_primitives[concat_index] = new mkldnn::concat(concat_pd);
+    set_primitive<mkldnn::concat>(mkldnn_primitives, concat_index, concat_pd);
 }
 
 void MKLDNNEmitter::build_slice(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1259,7 +1262,7 @@ void MKLDNNEmitter::build_slice(std::vector<mkldnn::memory*>& mkldnn_memories,
         *mkldnn_memories[input_index], *mkldnn_memories[result_index], attr);
     mkldnn_scratchpad_mds[slice_index] = new mkldnn::memory::desc(reorder_pd.scratchpad_desc());
 
-    mkldnn_primitives[slice_index] = new mkldnn::reorder(reorder_pd);
+    set_primitive<mkldnn::reorder>(mkldnn_primitives, slice_index, reorder_pd);
 }
 
 void MKLDNNEmitter::build_softmax_forward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1280,7 +1283,7 @@ void MKLDNNEmitter::build_softmax_forward(std::vector<mkldnn::memory*>& mkldnn_m
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, softmax_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[softmax_index] = new mkldnn::softmax_forward(softmax_pd);
+    set_primitive<mkldnn::softmax_forward>(mkldnn_primitives, softmax_index, softmax_pd);
 }
 
 void MKLDNNEmitter::build_leaky_relu(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1302,7 +1305,7 @@ void MKLDNNEmitter::build_leaky_relu(std::vector<mkldnn::memory*>& mkldnn_memori
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, leaky_relu_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[leaky_relu_index] = new mkldnn::eltwise_forward(leaky_relu_pd);
+    set_primitive<mkldnn::eltwise_forward>(mkldnn_primitives, leaky_relu_index, leaky_relu_pd);
 }
 
 void MKLDNNEmitter::build_bounded_relu(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1324,7 +1327,7 @@ void MKLDNNEmitter::build_bounded_relu(std::vector<mkldnn::memory*>& mkldnn_memo
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, bounded_relu_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[bounded_relu_index] = new mkldnn::eltwise_forward(bounded_relu_pd);
+    set_primitive<mkldnn::eltwise_forward>(mkldnn_primitives, bounded_relu_index, bounded_relu_pd);
 }
 
 void MKLDNNEmitter::build_gelu(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1345,7 +1348,7 @@ void MKLDNNEmitter::build_gelu(std::vector<mkldnn::memory*>& mkldnn_memories,
     size_t result_index = deps[1];
     build_memory(mkldnn_memories, gelu_pd.dst_desc(), result_index);
 
-    mkldnn_primitives[gelu_index] = new mkldnn::eltwise_forward(gelu_pd);
+    set_primitive<mkldnn::eltwise_forward>(mkldnn_primitives, gelu_index, gelu_pd);
 }
 
 void MKLDNNEmitter::build_gelu_backward(std::vector<mkldnn::memory*>& mkldnn_memories,
@@ -1374,7 +1377,7 @@ void MKLDNNEmitter::build_gelu_backward(std::vector<mkldnn::memory*>& mkldnn_mem
     size_t result_index = deps[2];
     build_memory(mkldnn_memories, gelu_bwd_pd.diff_dst_desc(), result_index);
 
-    mkldnn_primitives[gelu_bprop_index] = new mkldnn::eltwise_backward(gelu_bwd_pd);
+    set_primitive<mkldnn::eltwise_backward>(mkldnn_primitives, gelu_bprop_index, gelu_bwd_pd);
 }
 
 size_t MKLDNNEmitter::query_scratchpad_sum(const mkldnn::sum::primitive_desc pd)
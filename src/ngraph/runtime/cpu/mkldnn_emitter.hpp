@@ -1204,6 +1204,19 @@ namespace ngraph
                                   const mkldnn::memory::desc& desc,
                                   size_t index);
 
+                // Primitives carry no per-call state, so the contexts of a call frame
+                // may hand in primitives built by another context; those are kept.
+                template <typename PRIMITIVE, typename PRIMITIVE_DESC>
+                static void set_primitive(std::vector<mkldnn::primitive*>& mkldnn_primitives,
+                                          size_t index,
+                                          const PRIMITIVE_DESC& pd)
+                {
+                    if (mkldnn_primitives[index] == nullptr)
+                    {
+                        mkldnn_primitives[index] = new PRIMITIVE(pd);
+                    }
+                }
+
                 template <typename OP>
                 mkldnn::concat::primitive_desc get_concat_desc(const ngraph::Node* node,
                                                                size_t nargs)
@@ -1467,8 +1480,8 @@ namespace ngraph
                     mkldnn_scratchpad_mds[conv_idx] =
                         new mkldnn::memory::desc(conv_pd.scratchpad_desc());
 
-                    mkldnn::primitive* prim = new mkldnn::convolution_forward(conv_pd);
-                    mkldnn_primitives[conv_idx] = prim;
+                    set_primitive<mkldnn::convolution_forward>(
+                        mkldnn_primitives, conv_idx, conv_pd);
                 }
 
                 template <bool with_bias>
@@ -1507,8 +1520,8 @@ namespace ngraph
                     mkldnn_scratchpad_mds[ip_idx] =
                         new mkldnn::memory::desc(ip_pd.scratchpad_desc());
 
-                    mkldnn::primitive* prim = new mkldnn::inner_product_forward(ip_pd);
-                    mkldnn_primitives[ip_idx] = prim;
+                    set_primitive<mkldnn::inner_product_forward>(
+                        mkldnn_primitives, ip_idx, ip_pd);
                 }
 
                 size_t query_scratchpad_sum(const mkldnn::sum::primitive_desc);
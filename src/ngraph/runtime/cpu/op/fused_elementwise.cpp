@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::FusedElementwise::type_info;
+
+op::FusedElementwise::FusedElementwise(const OutputVector& args,
+                                       const vector<InputMode>& input_modes,
+                                       const vector<Instruction>& program,
+                                       const Shape& shape)
+    : Op(args)
+    , m_input_modes(input_modes)
+    , m_program(program)
+    , m_shape(shape)
+{
+    constructor_validate_and_infer_types();
+}
+
+size_t op::FusedElementwise::get_arity(Opcode opcode)
+{
+    switch (opcode)
+    {
+    case Opcode::Negative:
+    case Opcode::Abs:
+    case Opcode::Exp:
+    case Opcode::Log:
+    case Opcode::Sqrt:
+    case Opcode::Tanh:
+    case Opcode::Sigmoid:
+    case Opcode::Relu: return 1;
+    case Opcode::Add:
+    case Opcode::Subtract:
+    case Opcode::Multiply:
+    case Opcode::Divide:
+    case Opcode::Maximum:
+    case Opcode::Minimum: return 2;
+    case Opcode::Select: return 3;
+    }
+    return 0;
+}
+
+void op::FusedElementwise::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          m_input_modes.size() == get_input_size(),
+                          "Expected an input mode for each of the ",
+                          get_input_size(),
+                          " inputs, got ",
+                          m_input_modes.size());
+    NODE_VALIDATION_CHECK(this, !m_program.empty(), "The program is empty");
+    size_t count = shape_size(m_shape);
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        size_t input_count = shape_size(get_input_shape(i));
+        NODE_VALIDATION_CHECK(this,
+                              input_count > 0 &&
+                                  (m_input_modes[i] == InputMode::Full ? input_count == count
+                                                                       : count % input_count == 0),
+                              "Input ",
+                              i,
+                              " of shape ",
+                              get_input_shape(i),
+                              " does not fit the output shape ",
+                              m_shape);
+    }
+    for (size_t i = 0; i < m_program.size(); i++)
+    {
+        for (size_t j = 0; j < get_arity(m_program[i].opcode); j++)
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  m_program[i].args[j] < get_input_size() + i,
+                                  "Instruction ",
+                                  i,
+                                  " reads a register that is not written yet");
+        }
+    }
+    set_output_type(0, element::f32, m_shape);
+}
+
+shared_ptr<Node> op::FusedElementwise::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<FusedElementwise>(new_args, m_input_modes, m_program, m_shape);
+}
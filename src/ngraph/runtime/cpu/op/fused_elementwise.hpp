@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A connected subgraph of f32 elementwise ops evaluated in one pass over memory.
+        ///
+        /// The subgraph is kept as a small register program. Registers 0 to n-1 hold the n
+        /// inputs, register n+i holds the result of instruction i, and the result of the last
+        /// instruction is the output. An input that was broadcast inside the subgraph is read
+        /// through its InputMode instead of being materialized at full size.
+        class FusedElementwise : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"FusedElementwise", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class Opcode
+            {
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+                Maximum,
+                Minimum,
+                Negative,
+                Abs,
+                Exp,
+                Log,
+                Sqrt,
+                Tanh,
+                Sigmoid,
+                Relu,
+                Select
+            };
+
+            /// How output element i reads an input with n elements out of count
+            enum class InputMode
+            {
+                Full,   // element i
+                Scalar, // element 0
+                Inner,  // element i % n, the input was broadcast along leading axes
+                Outer   // element i / (count / n), the input was broadcast along trailing axes
+            };
+
+            struct Instruction
+            {
+                Opcode opcode;
+                std::array<size_t, 3> args;
+            };
+
+            CPU_BACKEND_API FusedElementwise(const OutputVector& args,
+                                             const std::vector<InputMode>& input_modes,
+                                             const std::vector<Instruction>& program,
+                                             const Shape& shape);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const std::vector<InputMode>& get_input_modes() const { return m_input_modes; }
+            const std::vector<Instruction>& get_program() const { return m_program; }
+            /// \returns The number of register arguments the opcode reads
+            CPU_BACKEND_API static size_t get_arity(Opcode opcode);
+
+        private:
+            std::vector<InputMode> m_input_modes;
+            std::vector<Instruction> m_program;
+            Shape m_shape;
+        };
+    }
+}
@@ -0,0 +1,254 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "cpu_elementwise_fusion.hpp"
+#include <typeindex>
+#include <unordered_map>
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Opcode = op::FusedElementwise::Opcode;
+using InputMode = op::FusedElementwise::InputMode;
+
+#define TI(x) type_index(typeid(x))
+
+static const unordered_map<type_index, Opcode>& get_opcodes()
+{
+    static const unordered_map<type_index, Opcode> opcodes{{TI(op::Add), Opcode::Add},
+                                                           {TI(op::Subtract), Opcode::Subtract},
+                                                           {TI(op::Multiply), Opcode::Multiply},
+                                                           {TI(op::Divide), Opcode::Divide},
+                                                           {TI(op::Maximum), Opcode::Maximum},
+                                                           {TI(op::Minimum), Opcode::Minimum},
+                                                           {TI(op::Negative), Opcode::Negative},
+                                                           {TI(op::Abs), Opcode::Abs},
+                                                           {TI(op::Exp), Opcode::Exp},
+                                                           {TI(op::Log), Opcode::Log},
+                                                           {TI(op::Sqrt), Opcode::Sqrt},
+                                                           {TI(op::Tanh), Opcode::Tanh},
+                                                           {TI(op::Sigmoid), Opcode::Sigmoid},
+                                                           {TI(op::Relu), Opcode::Relu},
+                                                           {TI(op::Select), Opcode::Select}};
+    return opcodes;
+}
+
+// An op can be fused if all its f32 inputs and its output have the same static shape.
+// Only the condition of Select may be boolean.
+static bool is_fusible(const shared_ptr<Node>& node)
+{
+    if (get_opcodes().count(TI(*node)) == 0 || node->get_output_size() != 1 ||
+        node->get_output_element_type(0) != element::f32 ||
+        node->get_output_partial_shape(0).is_dynamic())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        auto expected_type = is_type<op::Select>(node) && i == 0 ? element::boolean : element::f32;
+        if (node->get_input_element_type(i) != expected_type ||
+            node->get_input_partial_shape(i).is_dynamic() ||
+            node->get_input_shape(i) != node->get_output_shape(0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reads a broadcast through its argument when the pattern is one the kernel can index
+static bool get_broadcast_mode(const shared_ptr<Node>& node, Output<Node>& source, InputMode& mode)
+{
+    if (typeid(*node) != typeid(op::Broadcast))
+    {
+        return false;
+    }
+    auto broadcast = static_cast<op::Broadcast*>(node.get());
+    auto& axes = broadcast->get_broadcast_axes();
+    size_t rank = broadcast->get_output_shape(0).size();
+    source = broadcast->input_value(0);
+    if (shape_size(source.get_shape()) == 0)
+    {
+        return false;
+    }
+    if (shape_size(source.get_shape()) == 1)
+    {
+        mode = InputMode::Scalar;
+        return true;
+    }
+    // Leading axes: {0, ..., k-1}, trailing axes: {rank-k, ..., rank-1}
+    bool leading = true;
+    bool trailing = true;
+    for (auto axis : axes)
+    {
+        leading = leading && axis < axes.size();
+        trailing = trailing && axis >= rank - axes.size();
+    }
+    if (leading || trailing)
+    {
+        mode = leading ? InputMode::Inner : InputMode::Outer;
+        return true;
+    }
+    return false;
+}
+
+static shared_ptr<Node> fuse(const shared_ptr<Node>& root, const set<Node*>& members)
+{
+    OutputVector inputs;
+    vector<InputMode> input_modes;
+    vector<op::FusedElementwise::Instruction> program;
+    // Instructions read inputs as ~index until the number of inputs is known
+    unordered_map<Node*, size_t> instruction_index;
+
+    function<size_t(const Output<Node>&)> emit = [&](const Output<Node>& value) -> size_t {
+        auto node = value.get_node_shared_ptr();
+        if (members.count(node.get()) != 0)
+        {
+            auto it = instruction_index.find(node.get());
+            if (it != instruction_index.end())
+            {
+                return it->second;
+            }
+            op::FusedElementwise::Instruction instruction{get_opcodes().at(TI(*node)), {}};
+            for (size_t i = 0; i < node->get_input_size(); i++)
+            {
+                instruction.args[i] = emit(node->input_value(i));
+            }
+            program.push_back(instruction);
+            return instruction_index[node.get()] = program.size() - 1;
+        }
+
+        Output<Node> source = value;
+        InputMode mode = InputMode::Full;
+        get_broadcast_mode(node, source, mode);
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            if (inputs[i] == source && input_modes[i] == mode)
+            {
+                return ~i;
+            }
+        }
+        inputs.push_back(source);
+        input_modes.push_back(mode);
+        return ~(inputs.size() - 1);
+    };
+    emit(root);
+
+    for (auto& instruction : program)
+    {
+        for (size_t i = 0; i < op::FusedElementwise::get_arity(instruction.opcode); i++)
+        {
+            size_t& arg = instruction.args[i];
+            arg = arg >= program.size() ? ~arg : inputs.size() + arg;
+        }
+    }
+    return make_shared<op::FusedElementwise>(
+        inputs, input_modes, program, root->get_output_shape(0));
+}
+
+// replace_node only moves the control dependents of the root, the fused node has to take over
+// the control dependencies and dependents of every op it absorbs. Links between two members are
+// dropped with the members.
+static void transfer_control_dependencies(const shared_ptr<Node>& fused,
+                                          const set<Node*>& members)
+{
+    for (Node* member : members)
+    {
+        for (auto& dependency : member->get_control_dependencies())
+        {
+            if (members.count(dependency.get()) == 0)
+            {
+                fused->add_control_dependency(dependency);
+            }
+        }
+        for (Node* dependent : member->get_control_dependents())
+        {
+            if (members.count(dependent) == 0)
+            {
+                dependent->add_control_dependency(fused);
+            }
+        }
+    }
+    for (Node* member : members)
+    {
+        member->clear_control_dependencies();
+        member->clear_control_dependents();
+    }
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> f)
+{
+    // Each fusible op starts a tree of its own and takes over the trees of the producers it is
+    // the only user of, so every tree has a single root whose value leaves the tree
+    unordered_map<Node*, set<Node*>> trees;
+    vector<shared_ptr<Node>> roots;
+    for (auto n : f->get_ordered_ops())
+    {
+        if (!is_fusible(n))
+        {
+            continue;
+        }
+        auto& tree = trees[n.get()];
+        tree.insert(n.get());
+        for (auto& value : n->input_values())
+        {
+            auto producer = value.get_node();
+            auto it = trees.find(producer);
+            if (it != trees.end() && producer->get_users().size() == 1)
+            {
+                tree.insert(it->second.begin(), it->second.end());
+                trees.erase(it);
+            }
+        }
+        roots.push_back(n);
+    }
+
+    bool replaced = false;
+    for (auto& root : roots)
+    {
+        auto it = trees.find(root.get());
+        if (it == trees.end() || it->second.size() < 2)
+        {
+            continue;
+        }
+        auto fused = fuse(root, it->second);
+        NGRAPH_DEBUG << "CPUElementwiseFusion: replacing " << it->second.size() << " ops rooted at "
+                     << root->get_name() << " with " << fused->get_name();
+        transfer_control_dependencies(fused, it->second);
+        replace_node(root, fused);
+        replaced = true;
+    }
+    return replaced;
+}
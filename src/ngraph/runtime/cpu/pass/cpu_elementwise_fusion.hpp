@@ -0,0 +1,47 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces connected trees of f32 elementwise ops with a FusedElementwise
+                ///        node that evaluates them in one tiled pass, so that intermediate
+                ///        results never make a round trip through memory.
+                ///
+                /// A producer joins its consumer's tree only if the consumer is its sole user.
+                /// Broadcasts of scalars and broadcasts along leading or trailing axes feeding a
+                /// tree are read through the broadcast argument instead. The fused node takes
+                /// over the control dependencies of every op it replaces.
+                ///
+                /// Not run by default, enable with NGRAPH_PASS_ENABLES="CPUElementwiseFusion:1".
+                class CPUElementwiseFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -36,9 +36,12 @@ runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
         bufferID_to_tensorSets,
     unordered_map<descriptor::Tensor*, size_t>& tensor_to_bufferID,
     size_t alignment,
-    bool disable_memory_sharing)
+    bool disable_memory_sharing,
+    ngraph::pass::MemoryManager::allocation_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(disable_memory_sharing ? ngraph::pass::MemoryManager::allocation_scheme::NO_REUSE
+                                      : scheme)
     , m_bufferID_to_tensorSets(bufferID_to_tensorSets)
     , m_tensor_to_bufferID(tensor_to_bufferID)
 {
@@ -628,9 +631,11 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     // memory assignment using liveness analysis result
 
     // memory manager for non-cacheable ops, memory allocation will be freed when not longer in use
-    ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    ngraph::pass::MemoryManager mm(m_alignment, m_scheme);
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
+    // tensors whose pool offset came from mm, which an offline scheme only resolves at the end
+    unordered_set<descriptor::Tensor*> mm_tensors;
 
     // reuse memory
     if (!m_disable_memory_sharing)
@@ -756,9 +761,18 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                     // do not combine those two sets.
                     // change the label of output tensor set to that of input tensor set
                     output_buffer_it->second.first = input_buffer_it->second.first;
+                    bool from_mm = mm_tensors.count(input_tensor) != 0;
                     for (auto& ele_t : output_set)
                     {
                         ele_t->set_pool_offset(offset);
+                        if (from_mm)
+                        {
+                            mm_tensors.insert(ele_t);
+                        }
+                        else
+                        {
+                            mm_tensors.erase(ele_t);
+                        }
                     }
                 }
             }
@@ -783,18 +797,27 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                     size = e->size();
                 }
             }
-            if (m_tensor_caching.count(tensor) != 0)
+            bool from_mm = m_tensor_caching.count(tensor) == 0;
+            if (from_mm)
             {
-                offset = mm_caching.allocate(size);
+                offset = mm.allocate(size);
             }
             else
             {
-                offset = mm.allocate(size);
+                offset = mm_caching.allocate(size);
             }
             tensor->set_pool_offset(offset);
             for (auto& e : tensor_set)
             {
                 e->set_pool_offset(offset);
+                if (from_mm)
+                {
+                    mm_tensors.insert(e);
+                }
+                else
+                {
+                    mm_tensors.erase(e);
+                }
             }
         }
 
@@ -816,6 +839,12 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
+    mm.plan();
+    for (auto tensor : mm_tensors)
+    {
+        tensor->set_pool_offset(mm.get_offset(tensor->get_pool_offset()));
+    }
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -66,14 +66,56 @@ shared_ptr<runtime::Executable>
                                               bool enable_performance_collection)
 {
     return make_shared<runtime::dynamic::DynamicExecutable>(
-        function, m_wrapped_backend, enable_performance_collection);
+        function, m_wrapped_backend, enable_performance_collection, m_cache_capacity);
+}
+
+bool runtime::dynamic::DynamicBackend::set_config(const map<string, string>& config,
+                                                  string& error)
+{
+    map<string, string> wrapped_config{config};
+    auto it = wrapped_config.find("dynamic_cache_capacity");
+    if (it != wrapped_config.end())
+    {
+        int64_t capacity;
+        try
+        {
+            capacity = parse_string<int64_t>(it->second);
+        }
+        catch (const exception&)
+        {
+            capacity = -1;
+        }
+        if (capacity < 0)
+        {
+            error = "dynamic_cache_capacity must be a non-negative integer, got '" + it->second +
+                    "'";
+            return false;
+        }
+        m_cache_capacity = capacity;
+        wrapped_config.erase(it);
+        if (wrapped_config.empty())
+        {
+            error = "";
+            return true;
+        }
+    }
+    return m_wrapped_backend->set_config(wrapped_config, error);
+}
+
+map<string, string> runtime::dynamic::DynamicBackend::get_config() const
+{
+    map<string, string> config = m_wrapped_backend->get_config();
+    config["dynamic_cache_capacity"] = to_string(m_cache_capacity);
+    return config;
 }
 
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
-                                                       bool enable_performance_collection)
+                                                       bool enable_performance_collection,
+                                                       size_t cache_capacity)
     : m_wrapped_function(wrapped_function)
     , m_wrapped_backend(wrapped_backend)
+    , m_lru(make_shared<runtime::LRUCache>(cache_capacity))
     , m_enable_performance_collection(enable_performance_collection)
 {
     pass::Manager passes;
@@ -114,108 +156,76 @@ bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
+    NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
 
-    std::vector<int> merged_input_shapes;
-    std::ostringstream key;
-    size_t loop_count = 0;
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
     for (auto& input : inputs)
     {
-        if (m_wrapped_function->get_parameters()[loop_count]->is_relevant_to_shapes())
+        // TODO(amprocte): Move has_storage() to runtime::Tensor?
+        if (auto dynamic_tensor = std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
         {
-            // Caching on values of Shape relevant inputs
-            int size = input->get_size_in_bytes() / (input->get_element_type().bitwidth() / 8);
-            std::vector<int64_t> data(size);
-            input->read(data.data(), input->get_size_in_bytes());
-            for (int i = 0; i < input->get_element_count(); i++)
-            {
-                merged_input_shapes.emplace_back(data[i]);
-            }
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
         }
         else
         {
-            // Caching on all remaining shapes
-            for (int i = 0; i < input->get_shape().size(); i++)
-            {
-                merged_input_shapes.emplace_back(input->get_shape()[i]);
-            }
+            wrapped_inputs.push_back(input);
         }
-        // -1 is the separator.
-        // So if shape of Input 1 = {2, 2, 3, 3} & Input 2 = {4, 5}
-        // the key would be 2, 2, 3, 3, -1, 4, 5, -1
-        merged_input_shapes.emplace_back(-1);
-        loop_count++;
     }
 
-    std::copy(merged_input_shapes.begin(),
-              merged_input_shapes.end(),
-              std::ostream_iterator<int>(key, ", "));
-
-    if (m_lru->is_cached(merged_input_shapes))
+    // We cache on:
+    // (1) all element types and shapes;
+    // (2) all values of shape-relevant input tensors.
+    // Shape-relevant inputs are small, so their values are read into a stack buffer and the key
+    // is hashed without allocating.
+    CacheKeyBuilder key_builder;
+    char value_buffer[256];
+    for (size_t i = 0; i < wrapped_inputs.size(); i++)
     {
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
-
-        std::shared_ptr<Function> clone = m_lru->get_cloned_function(merged_input_shapes);
-        const ResultVector& results = clone->get_results();
-        for (auto& result : results)
+        auto& input = wrapped_inputs[i];
+        const Shape& shape = input->get_shape();
+        key_builder.add(static_cast<uint64_t>(element::Type_t(input->get_element_type())));
+        key_builder.add(shape.size());
+        for (size_t d : shape)
         {
-            NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                         "Shape staticization failed for result node ",
-                         *result);
+            key_builder.add(d);
         }
-        NGRAPH_CHECK(results.size() == outputs.size());
-
-        for (size_t i = 0; i < outputs.size(); i++)
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
         {
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
+            size_t size = input->get_size_in_bytes();
+            if (size <= sizeof(value_buffer))
             {
-                dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                             results[i]->get_output_shape(0));
-                wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
+                input->read(value_buffer, size);
+                key_builder.add(value_buffer, size);
             }
             else
             {
-                wrapped_outputs.push_back(outputs[i]);
+                std::vector<char> values(size);
+                input->read(values.data(), size);
+                key_builder.add(values.data(), size);
             }
         }
-
-        return m_lru->get_cached_entry(merged_input_shapes)->call(wrapped_outputs, inputs);
     }
-    else
-    {
-        NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
+    CacheKey key = key_builder.get_key();
 
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
+    auto entry = m_lru->get(key);
+    if (!entry)
+    {
         std::vector<element::Type> arg_element_types;
         std::vector<PartialShape> arg_shapes;
-
         std::shared_ptr<Function> clone;
         {
             // We'll use AlignedBuffers to back the base pointers, storing them in this vector for
-            // RAII
-            // purposes.
+            // RAII purposes.
             std::vector<AlignedBuffer> arg_buffers;
-            arg_buffers.reserve(inputs.size());
-            std::vector<void*> arg_value_base_pointers(inputs.size());
+            arg_buffers.reserve(wrapped_inputs.size());
+            std::vector<void*> arg_value_base_pointers(wrapped_inputs.size());
 
-            size_t i = 0;
-
-            for (auto& input : inputs)
+            for (size_t i = 0; i < wrapped_inputs.size(); i++)
             {
+                auto& input = wrapped_inputs[i];
                 if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
                 {
-                    // TODO(amprocte): Move has_storage() to runtime::Tensor?
-                    if (auto dynamic_tensor =
-                            std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                    {
-                        NGRAPH_CHECK(dynamic_tensor->has_storage());
-                    }
-
                     arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
                     arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
 
@@ -227,24 +237,8 @@ bool runtime::dynamic::DynamicExecutable::call(
                 {
                     arg_value_base_pointers[i] = nullptr;
                 }
-
-                if (auto dynamic_tensor =
-                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                {
-                    NGRAPH_CHECK(dynamic_tensor->has_storage());
-                    arg_element_types.push_back(
-                        dynamic_tensor->get_wrapped_tensor()->get_element_type());
-                    arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
-                    wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
-                }
-                else
-                {
-                    arg_element_types.push_back(input->get_element_type());
-                    arg_shapes.push_back(input->get_shape());
-                    wrapped_inputs.push_back(input);
-                }
-
-                i++;
+                arg_element_types.push_back(input->get_element_type());
+                arg_shapes.push_back(input->get_shape());
             }
 
             clone = specialize_function(
@@ -283,40 +277,38 @@ bool runtime::dynamic::DynamicExecutable::call(
         pass_val.register_pass<pass::Validate>();
         pass_val.run_passes(clone);
 
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+        auto compiled_executable =
+            m_wrapped_backend->compile(clone, m_enable_performance_collection);
+        // Put compiled executable in the cache.
+        entry = m_lru->add(key, compiled_executable, clone);
+    }
+
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+    const ResultVector& results = entry->function->get_results();
+    for (auto& result : results)
+    {
+        NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
+                     "Shape staticization failed for result node ",
+                     *result);
+    }
+    NGRAPH_CHECK(results.size() == outputs.size());
 
-        const ResultVector& results = clone->get_results();
-        for (auto& result : results)
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
         {
-            NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                         "Shape staticization failed for result node ",
-                         *result);
+            dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
+                                         results[i]->get_output_shape(0));
+            wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
         }
-        NGRAPH_CHECK(results.size() == outputs.size());
-
-        for (size_t i = 0; i < outputs.size(); i++)
+        else
         {
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
-            {
-                dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                             results[i]->get_output_shape(0));
-                wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
-            {
-                wrapped_outputs.push_back(outputs[i]);
-            }
+            wrapped_outputs.push_back(outputs[i]);
         }
-
-        auto compiled_executable =
-            m_wrapped_backend->compile(clone, m_enable_performance_collection);
-        // Put compiled executable in the cache.
-        m_lru->add_entry(merged_input_shapes, compiled_executable, clone);
-        auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
-
-        return result;
     }
+
+    return entry->executable->call(wrapped_outputs, wrapped_inputs);
 }
 
 runtime::dynamic::DynamicTensor::DynamicTensor(
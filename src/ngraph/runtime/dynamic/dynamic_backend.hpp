@@ -71,8 +71,15 @@ public:
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
 
+    /// \brief Handles "dynamic_cache_capacity", the number of specialized executables each
+    ///     DynamicExecutable compiled afterwards keeps. Other keys go to the wrapped backend.
+    bool set_config(const std::map<std::string, std::string>& config,
+                    std::string& error) override;
+    std::map<std::string, std::string> get_config() const override;
+
 private:
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    size_t m_cache_capacity{0};
 };
 
 ///
@@ -92,17 +99,21 @@ private:
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
 {
 public:
+    /// \param cache_capacity Number of specialized executables to keep, 0 for the
+    ///     LRUCache default
     DynamicExecutable(std::shared_ptr<Function> wrapped_function,
                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
-                      bool enable_performance_collection = false);
+                      bool enable_performance_collection = false,
+                      size_t cache_capacity = 0);
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief The cache of executables specialized for input shapes and shape-relevant values
+    std::shared_ptr<ngraph::runtime::LRUCache> get_cache() const { return m_lru; }
 private:
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
-    std::shared_ptr<ngraph::runtime::LRUCache> m_lru =
-        std::make_shared<ngraph::runtime::LRUCache>();
+    std::shared_ptr<ngraph::runtime::LRUCache> m_lru;
     bool m_enable_performance_collection;
 };
 
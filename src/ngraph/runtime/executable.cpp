@@ -14,16 +14,30 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <sstream>
+#include <thread>
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Runs the executions started with begin_execute, so concurrent requests share a bounded
+    // set of threads instead of each starting its own
+    runtime::ThreadPool& get_execute_pool()
+    {
+        static runtime::ThreadPool pool(max(1u, thread::hardware_concurrency()));
+        return pool;
+    }
+}
+
 runtime::Executable::Executable()
 {
 }
@@ -39,6 +53,51 @@ bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Te
     return call(outputs, inputs);
 }
 
+future<bool> runtime::Executable::begin_execute(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    auto task = make_shared<packaged_task<bool()>>(
+        [this, outputs, inputs]() { return call(outputs, inputs); });
+    future<bool> result = task->get_future();
+    if (is_reentrant())
+    {
+        get_execute_pool().submit([task]() { (*task)(); });
+        return result;
+    }
+
+    bool start = false;
+    {
+        lock_guard<mutex> lock(m_execute_mutex);
+        m_execute_queue.push_back([task]() { (*task)(); });
+        start = !m_execute_running;
+        m_execute_running = true;
+    }
+    if (start)
+    {
+        get_execute_pool().submit([this]() { run_execute_queue(); });
+    }
+    return result;
+}
+
+void runtime::Executable::run_execute_queue()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            lock_guard<mutex> lock(m_execute_mutex);
+            if (m_execute_queue.empty())
+            {
+                m_execute_running = false;
+                return;
+            }
+            task = move(m_execute_queue.front());
+            m_execute_queue.pop_front();
+        }
+        task();
+    }
+}
+
 void runtime::Executable::validate(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                    const vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -51,6 +55,24 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Executes a single iteration of a Function on another thread.
+    ///
+    /// Executions run on a thread pool shared by all executables. Executions of an executable
+    /// that is not reentrant are queued and run one at a time. The executable and the tensors
+    /// must stay alive until the returned future is ready, and an execution must not wait on
+    /// another one started with begin_execute.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \returns A future holding the result of call(), or the exception it threw
+    virtual std::future<bool>
+        begin_execute(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                      const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    /// \brief Whether call() may run on several threads at once
+    ///
+    /// begin_execute serializes the executions of an executable that is not reentrant.
+    virtual bool is_reentrant() const { return false; }
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
@@ -159,4 +181,13 @@ protected:
 
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+
+private:
+    void run_execute_queue();
+
+    // Executions started with begin_execute on an executable that is not reentrant
+    std::mutex m_execute_mutex;
+    std::deque<std::function<void()>> m_execute_queue;
+    // Whether a pool thread is running m_execute_queue, guarded by m_execute_mutex
+    bool m_execute_running{false};
 };
@@ -0,0 +1,290 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "ngraph/cpio.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const string s_entry_extension = ".ngexec";
+
+// 64-bit FNV-1a
+static uint64_t hash_bytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= p[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+runtime::ExecutableCache::ExecutableCache(const shared_ptr<Backend>& backend,
+                                          const string& backend_name,
+                                          const string& directory,
+                                          size_t max_size_bytes)
+    : m_backend(backend)
+    , m_backend_name(backend_name)
+    , m_directory(directory)
+    , m_max_size_bytes(max_size_bytes)
+    , m_hit_count(0)
+    , m_miss_count(0)
+    , m_eviction_count(0)
+{
+    NGRAPH_CHECK(m_backend, "ExecutableCache needs a backend");
+    if (!file_util::exists(m_directory))
+    {
+        file_util::make_directory(m_directory);
+    }
+}
+
+shared_ptr<runtime::Executable>
+    runtime::ExecutableCache::compile(shared_ptr<Function> func, bool enable_performance_data)
+{
+    return compile(func, nullptr, enable_performance_data);
+}
+
+shared_ptr<runtime::Executable> runtime::ExecutableCache::compile(shared_ptr<Function> func,
+                                                                  pass::PassConfig& pass_config,
+                                                                  bool enable_performance_data)
+{
+    return compile(func, &pass_config, enable_performance_data);
+}
+
+shared_ptr<runtime::Executable> runtime::ExecutableCache::compile(shared_ptr<Function> func,
+                                                                  pass::PassConfig* pass_config,
+                                                                  bool enable_performance_data)
+{
+    if (enable_performance_data)
+    {
+        return pass_config ? m_backend->compile(func, *pass_config, true)
+                           : m_backend->compile(func, true);
+    }
+
+    string key = get_key(func, pass_config);
+    string path = get_entry_path(key);
+    shared_ptr<Executable> exec = load_entry(path, key);
+    if (exec)
+    {
+        m_hit_count++;
+        // Refresh the modification time, which orders entries for eviction
+        utime(path.c_str(), nullptr);
+        return exec;
+    }
+
+    m_miss_count++;
+    exec = pass_config ? m_backend->compile(func, *pass_config, false)
+                       : m_backend->compile(func, false);
+    if (exec)
+    {
+        store_entry(path, key, *exec);
+    }
+    return exec;
+}
+
+string runtime::ExecutableCache::get_key(shared_ptr<Function> func,
+                                         const pass::PassConfig* pass_config) const
+{
+    vector<shared_ptr<Node>> constants;
+    string structure = serialize_structure(func, constants);
+
+    stringstream key;
+    key << "ngraph " << get_ngraph_version_string() << "\n";
+    key << "backend " << m_backend_name << " " << m_backend->get_version() << "\n";
+    // Settings such as the interpreter's inter_op_threads are applied by Backend::load as well,
+    // so an entry only matches a backend configured the way it was when the entry was stored
+    key << "backend_config";
+    for (auto& entry : m_backend->get_config())
+    {
+        key << " " << entry.first << "=" << entry.second;
+    }
+    key << "\n";
+    key << "pass_config";
+    if (pass_config)
+    {
+        for (auto& enable : pass_config->get_enables())
+        {
+            key << " " << enable.first << "=" << enable.second;
+        }
+        key << ";";
+        for (auto& attribute : pass_config->get_pass_attributes())
+        {
+            key << " " << attribute.first << "=" << attribute.second;
+        }
+    }
+    key << "\n";
+    key << "graph " << structure << "\n";
+    key << "constants";
+    for (const shared_ptr<Node>& node : constants)
+    {
+        auto c = static_pointer_cast<op::Constant>(node);
+        size_t size = (shape_size(c->get_shape()) * c->get_element_type().bitwidth() + 7) / 8;
+        key << " " << hex << hash_bytes(c->get_data_ptr(), size) << dec;
+    }
+    key << "\n";
+    return key.str();
+}
+
+string runtime::ExecutableCache::get_entry_path(const string& key) const
+{
+    stringstream name;
+    name << hex << setw(16) << setfill('0') << hash_bytes(key.data(), key.size())
+         << s_entry_extension;
+    return file_util::path_join(m_directory, name.str());
+}
+
+shared_ptr<runtime::Executable> runtime::ExecutableCache::load_entry(const string& path,
+                                                                     const string& key)
+{
+    shared_ptr<Executable> exec;
+    if (!file_util::exists(path))
+    {
+        return exec;
+    }
+    try
+    {
+        cpio::Reader reader(path);
+        const vector<cpio::FileInfo>& file_info = reader.get_file_info();
+        // The full key is stored with the entry so a hash collision is a miss, not a wrong
+        // executable
+        if (file_info.size() == 2 && file_info[0].get_name() == "key" &&
+            file_info[1].get_name() == "executable")
+        {
+            vector<char> stored_key = reader.read(file_info[0]);
+            if (string(stored_key.begin(), stored_key.end()) == key)
+            {
+                vector<char> data = reader.read(file_info[1]);
+                stringstream in(string(data.begin(), data.end()));
+                exec = m_backend->load(in);
+            }
+        }
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_WARN << "Ignoring unreadable executable cache entry " << path << ": " << e.what();
+        exec = nullptr;
+    }
+    return exec;
+}
+
+void runtime::ExecutableCache::store_entry(const string& path, const string& key, Executable& exec)
+{
+    stringstream saved;
+    try
+    {
+        exec.save(saved);
+    }
+    catch (const exception&)
+    {
+        // The backend cannot save executables; there is nothing to cache
+        return;
+    }
+    string data = saved.str();
+    // cpio records 32 bit sizes
+    NGRAPH_CHECK(key.size() <= numeric_limits<uint32_t>::max() &&
+                     data.size() <= numeric_limits<uint32_t>::max(),
+                 "Executable of ",
+                 data.size(),
+                 " bytes is too large for the executable cache");
+
+    // Write under a name no other writer uses, then rename into place
+    stringstream tmp_path;
+    tmp_path << path << ".tmp" << hex << random_device()() << this_thread::get_id();
+    {
+        cpio::Writer writer(tmp_path.str());
+        writer.write("key", key.data(), static_cast<uint32_t>(key.size()));
+        writer.write("executable", data.data(), static_cast<uint32_t>(data.size()));
+    }
+    if (rename(tmp_path.str().c_str(), path.c_str()) != 0)
+    {
+        // Windows does not replace an existing file
+        remove(path.c_str());
+        if (rename(tmp_path.str().c_str(), path.c_str()) != 0)
+        {
+            remove(tmp_path.str().c_str());
+            return;
+        }
+    }
+
+    if (m_max_size_bytes > 0)
+    {
+        evict(path);
+    }
+}
+
+void runtime::ExecutableCache::evict(const string& keep_path)
+{
+    lock_guard<mutex> lock(m_evict_mutex);
+    // (modification time, size, path) of every entry
+    vector<tuple<time_t, size_t, string>> entries;
+    size_t total_size = 0;
+    file_util::iterate_files(m_directory, [&](const string& file, bool is_dir) {
+        if (!is_dir && file.size() > s_entry_extension.size() &&
+            file.compare(file.size() - s_entry_extension.size(),
+                         s_entry_extension.size(),
+                         s_entry_extension) == 0)
+        {
+            struct stat st;
+            if (stat(file.c_str(), &st) == 0)
+            {
+                size_t size = static_cast<size_t>(st.st_size);
+                entries.emplace_back(st.st_mtime, size, file);
+                total_size += size;
+            }
+        }
+    });
+    sort(entries.begin(), entries.end());
+    for (auto& entry : entries)
+    {
+        if (total_size <= m_max_size_bytes)
+        {
+            break;
+        }
+        // Never evict the entry that was just stored, even if it is older by timestamp
+        // resolution
+        if (get<2>(entry) != keep_path && remove(get<2>(entry).c_str()) == 0)
+        {
+            total_size -= get<1>(entry);
+            m_eviction_count++;
+        }
+    }
+}
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ngraph/function.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ExecutableCache;
+    }
+}
+
+/// \brief On-disk cache of compiled Executables for one Backend.
+///
+/// Entries are keyed by the structure of the Function (see serialize_structure), the data of its
+/// Constants, the pass config, the backend with its Backend::get_config and the nGraph version.
+/// On a hit the saved Executable is loaded with Backend::load; on a miss the Function is
+/// compiled and, if the Executable supports Executable::save, stored for the next process.
+/// Entries are written to a temporary file and renamed into place, so concurrent processes
+/// sharing the directory never see a partial entry. When the directory grows past its size
+/// limit the least recently used entries are removed.
+class NGRAPH_API ngraph::runtime::ExecutableCache
+{
+public:
+    /// \param backend The backend that compiles and loads the executables
+    /// \param backend_name The name the backend was created with, such as "CPU"
+    /// \param directory Directory holding the cache entries. It is created if missing.
+    /// \param max_size_bytes Total size of the entries above which the least recently used are
+    ///     removed. 0 means no limit.
+    ExecutableCache(const std::shared_ptr<Backend>& backend,
+                    const std::string& backend_name,
+                    const std::string& directory,
+                    size_t max_size_bytes = 0);
+
+    /// \brief Returns the cached Executable for func, compiling and storing it on a miss.
+    ///
+    /// Saved executables do not carry performance collection, so requests with
+    /// enable_performance_data bypass the cache.
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> func,
+                                        bool enable_performance_data = false);
+
+    /// \brief Returns the cached Executable for func, compiling and storing it on a miss.
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> func,
+                                        pass::PassConfig& pass_config,
+                                        bool enable_performance_data = false);
+
+    /// \brief Number of compile calls served from the cache
+    size_t get_hit_count() const { return m_hit_count; }
+    /// \brief Number of compile calls that had to compile
+    size_t get_miss_count() const { return m_miss_count; }
+    /// \brief Number of entries removed to stay under the size limit
+    size_t get_eviction_count() const { return m_eviction_count; }
+
+private:
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> func,
+                                        pass::PassConfig* pass_config,
+                                        bool enable_performance_data);
+    std::string get_key(std::shared_ptr<Function> func, const pass::PassConfig* pass_config) const;
+    std::string get_entry_path(const std::string& key) const;
+    std::shared_ptr<Executable> load_entry(const std::string& path, const std::string& key);
+    void store_entry(const std::string& path, const std::string& key, Executable& exec);
+    void evict(const std::string& keep_path);
+
+    std::shared_ptr<Backend> m_backend;
+    std::string m_backend_name;
+    std::string m_directory;
+    size_t m_max_size_bytes;
+    std::atomic<size_t> m_hit_count;
+    std::atomic<size_t> m_miss_count;
+    std::atomic<size_t> m_eviction_count;
+    std::mutex m_evict_mutex;
+};
@@ -68,9 +68,6 @@ public:
     GCPUExecutable(const std::shared_ptr<Function>& function,
                    bool enable_performance_collection = false);
 
-    bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
-              const std::vector<std::shared_ptr<Tensor>>& intputs) override;
-
 private:
     int get_alignment() const { return 64; }
     void generate_calls(const element::Type& type,
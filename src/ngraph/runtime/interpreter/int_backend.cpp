@@ -22,6 +22,7 @@
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/runtime/interpreter/int_executable.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -36,11 +37,13 @@ extern "C" INTERPRETER_BACKEND_API void ngraph_register_interpreter_backend()
 }
 
 runtime::interpreter::INTBackend::INTBackend()
+    : m_native_fused_ops{INTExecutable::get_native_fused_ops()}
 {
 }
 
 runtime::interpreter::INTBackend::INTBackend(const vector<string>& unsupported_op_name_list)
     : m_unsupported_op_name_list{unsupported_op_name_list.begin(), unsupported_op_name_list.end()}
+    , m_native_fused_ops{INTExecutable::get_native_fused_ops()}
 {
 }
 
@@ -60,7 +63,8 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    return make_shared<INTExecutable>(
+        function, enable_performance_collection, m_thread_pool, m_native_fused_ops);
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -91,7 +95,8 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             {
                 vector<char> buffer = reader.read(info);
                 string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                exec = shared_ptr<INTExecutable>(
+                    new INTExecutable(model_string, m_thread_pool, m_native_fused_ops));
                 break;
             }
         }
@@ -109,5 +114,54 @@ bool runtime::interpreter::INTBackend::set_config(const map<string, string>& con
         error = it->second;
         rc = true;
     }
+    it = config.find("inter_op_threads");
+    if (it != config.end())
+    {
+        int64_t thread_count;
+        try
+        {
+            thread_count = parse_string<int64_t>(it->second);
+        }
+        catch (const exception&)
+        {
+            thread_count = -1;
+        }
+        if (thread_count < 0)
+        {
+            error = "inter_op_threads must be a non-negative integer, got '" + it->second + "'";
+            return false;
+        }
+        // Executables compiled after this point share the pool, ones compiled before keep
+        // the pool they were created with. A count of 0 or 1 runs ops serially.
+        m_thread_pool = thread_count > 1 ? make_shared<ThreadPool>(thread_count) : nullptr;
+        m_inter_op_threads = static_cast<size_t>(thread_count);
+        rc = true;
+    }
+    it = config.find("native_fused_ops");
+    if (it != config.end())
+    {
+        set<string> native_fused_ops;
+        for (const string& name : split(it->second, ',', true))
+        {
+            if (name.empty())
+            {
+                continue;
+            }
+            if (INTExecutable::get_native_fused_ops().count(name) == 0)
+            {
+                error = "native_fused_ops: no native kernel for '" + name + "'";
+                return false;
+            }
+            native_fused_ops.insert(name);
+        }
+        m_native_fused_ops = native_fused_ops;
+        rc = true;
+    }
     return rc;
 }
+
+map<string, string> runtime::interpreter::INTBackend::get_config() const
+{
+    return {{"inter_op_threads", to_string(m_inter_op_threads)},
+            {"native_fused_ops", join(m_native_fused_ops, ",")}};
+}
@@ -37,6 +37,7 @@ namespace ngraph
             class INTExecutable;
             class INTBackendConstructor;
         }
+        class ThreadPool;
     }
 }
 
@@ -60,8 +61,18 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    /// \brief Supported keys
+    ///     inter_op_threads: number of threads used to run independent ops of executables
+    ///         compiled afterwards. 0 or 1 runs ops serially in topological order.
+    ///     native_fused_ops: comma separated names of the fused ops that executables compiled
+    ///         afterwards run with native kernels, the rest are decomposed. Defaults to all of
+    ///         INTExecutable::get_native_fused_ops(), an empty list decomposes every fused op.
     bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
+    std::map<std::string, std::string> get_config() const override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    std::shared_ptr<ThreadPool> m_thread_pool;
+    size_t m_inter_op_threads = 0;
+    std::set<std::string> m_native_fused_ops;
 };
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
+
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/chrome_trace.hpp"
 #include "ngraph/cpio.hpp"
@@ -26,6 +29,7 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/serializer.hpp"
@@ -36,6 +40,8 @@ using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
 
+static const uint32_t s_trace_category = event::Manager::intern("Interpreter");
+
 runtime::interpreter::OP_TYPEID runtime::interpreter::INTExecutable::get_typeid(const Node& node)
 {
     const NodeTypeInfo& type_info = node.get_type_info();
@@ -59,9 +65,13 @@ runtime::interpreter::OP_TYPEID runtime::interpreter::INTExecutable::get_typeid(
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
-                                                   bool enable_performance_collection)
+                                                   bool enable_performance_collection,
+                                                   const shared_ptr<ThreadPool>& thread_pool,
+                                                   const set<string>& native_fused_ops)
     : m_is_compiled{true}
     , m_performance_counters_enabled{enable_performance_collection}
+    , m_thread_pool{thread_pool}
+    , m_native_fused_ops{native_fused_ops}
 {
 #ifdef INTERPRETER_FORCE_SERIALIZE
     // To verify that the serializer works correctly let's just run this graph round-trip
@@ -70,23 +80,40 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
 #else
     m_function = clone_function(*function);
 #endif
+    // Fused ops with a native kernel run as a single op instead of a chain of small ops that
+    // each sweep over memory. TensorIterator runs its body in a loop instead of being unrolled.
+    auto is_native = [&native_fused_ops](const Node& node) {
+        return native_fused_ops.count(node.description()) != 0 ||
+               is_type<op::TensorIterator>(&node);
+    };
     pass::Manager pass_manager;
     pass_manager.register_pass<pass::LikeReplacement>();
-    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::FusedOpDecomposition>(is_native);
     pass_manager.register_pass<pass::Opset0Downgrade>();
     // Need to decompose any v0 fused ops, which were produced by the downgrade pass
-    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::FusedOpDecomposition>(is_native);
     pass_manager.run_passes(m_function);
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_execution_plan();
+}
+
+const set<string>& runtime::interpreter::INTExecutable::get_native_fused_ops()
+{
+    static const set<string> native_fused_ops{"Gelu", "LayerNorm", "MVN", "NormalizeL2"};
+    return native_fused_ops;
 }
 
-runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
+runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string,
+                                                   const shared_ptr<ThreadPool>& thread_pool,
+                                                   const set<string>& native_fused_ops)
     : m_is_compiled{true}
     , m_performance_counters_enabled{false}
+    , m_thread_pool{thread_pool}
+    , m_native_fused_ops{native_fused_ops}
 {
     m_function = deserialize(model_string);
     for (auto node : m_function->get_ordered_ops())
@@ -94,99 +121,112 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_execution_plan();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::build_execution_plan()
 {
-    event::Duration d1("call", "Interpreter");
-
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
+    // Intermediate tensors can only be laid out in the arena when every shape is known
+    bool all_static = true;
+    for (auto& node : m_nodes)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
+        for (size_t i = 0; i < node->get_output_size(); ++i)
+        {
+            if (node->get_output_partial_shape(i).is_dynamic() ||
+                node->get_output_element_type(i).is_dynamic())
+            {
+                all_static = false;
+            }
+        }
     }
-    if (m_nan_check_enabled)
+    if (m_thread_pool)
     {
-        perform_nan_check(func_inputs);
+        build_dependency_graph();
     }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
+    if (all_static)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
+        if (m_thread_pool)
+        {
+            // pass::MemoryLayout reuses buffers in topological order, which ops dispatched to
+            // the pool do not follow
+            layout_concurrent_memory();
+        }
+        else
+        {
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::Liveness>();
+            pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+            pass_manager.run_passes(m_function);
+        }
     }
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
+    unordered_map<descriptor::Tensor*, size_t> slot_map;
+    auto add_slot = [&](descriptor::Tensor* tensor, SlotBinding binding) {
+        slot_map.insert({tensor, m_tensor_slots.size()});
+        m_tensor_slots.push_back(TensorSlot{tensor, binding, nullptr});
+    };
+
+    // map function params and outputs to the external slots
     for (auto param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            add_slot(&param->output(i).get_tensor(), SlotBinding::External);
         }
     }
-
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    for (auto output : get_results())
     {
-        auto output = get_results()[output_count];
         if (!is_type<op::Result>(output))
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->get_output_tensor(0);
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        add_slot(&output->get_output_tensor(0), SlotBinding::External);
     }
+    m_external_slot_count = m_tensor_slots.size();
 
-    // for each ordered op in the graph
     for (auto op : m_nodes)
     {
-        event::Duration d2(op->description(), "Interpreter");
-        if (op->is_parameter())
-        {
-            continue;
-        }
-
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
+        OpPlan plan;
         for (auto input : op->inputs())
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            plan.m_input_slots.push_back(slot_map.at(&input.get_tensor()));
         }
-
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            auto it = slot_map.find(tensor);
+            if (it == slot_map.end())
             {
-                host_tensor = make_shared<HostTensor>(op->output(i));
-                tensor_map.insert({tensor, host_tensor});
-            }
-            else
-            {
-                host_tensor = it->second;
+                SlotBinding binding = SlotBinding::Dynamic;
+                if (op->is_constant())
+                {
+                    binding = SlotBinding::Constant;
+                }
+                else if (all_static)
+                {
+                    binding = SlotBinding::Pool;
+                }
+                add_slot(tensor, binding);
+                it = slot_map.find(tensor);
+                if (binding == SlotBinding::Constant)
+                {
+                    // Kernels only read their inputs, so every call reads the weights in place
+                    auto constant = static_pointer_cast<op::Constant>(op);
+                    m_tensor_slots[it->second].m_constant = make_shared<HostTensor>(
+                        tensor->get_element_type(),
+                        tensor->get_shape(),
+                        const_cast<void*>(constant->get_data_ptr()),
+                        tensor->get_name());
+                }
             }
-            op_outputs.push_back(host_tensor);
+            plan.m_output_slots.push_back(it->second);
         }
 
         // get op type
-        element::Type type;
         if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
             is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op))
         {
-            type = op->get_input_element_type(0);
+            plan.m_type = op->get_input_element_type(0);
         }
         else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
                  is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
@@ -194,38 +234,697 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             // Get the type of the second input, not the first
             // All BinaryElementwiseComparision ops have the same type for inputs
             // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            plan.m_type = op->get_input_element_type(1);
         }
         else if (is_type<op::TopK>(op))
         {
-            type = op->get_output_element_type(1);
+            plan.m_type = op->get_output_element_type(1);
         }
-        else
+        else if (op->get_output_size() > 0)
         {
-            type = op->get_output_element_type(0);
+            plan.m_type = op->get_output_element_type(0);
         }
+        m_op_plans.push_back(plan);
+
+        if (auto tensor_iterator = as_type_ptr<op::TensorIterator>(op))
+        {
+            // The body runs inside one of our ops, so it never gets the thread pool; a worker
+            // waiting on tasks queued behind it would deadlock
+            auto body = tensor_iterator->get_body();
+            m_body_executables[op.get()] = make_shared<INTExecutable>(
+                make_shared<Function>(body->get_results(), body->get_parameters()),
+                false,
+                nullptr,
+                m_native_fused_ops);
+        }
+    }
 
-        if (m_performance_counters_enabled)
+    for (auto& op : m_nodes)
+    {
+        m_trace_names.push_back(event::Manager::intern(op->description()));
+    }
+    if (m_performance_counters_enabled)
+    {
+        // Create every timer up front so worker threads never insert into the map
+        for (auto& op : m_nodes)
         {
-            m_timer_map[op].start();
+            m_timer_map[op];
         }
-        if (!op->evaluate(op_outputs, op_inputs))
+    }
+    m_call_frames.push_back(create_call_frame());
+}
+
+void runtime::interpreter::INTExecutable::build_dependency_graph()
+{
+    unordered_map<const Node*, size_t> op_index_map;
+    for (size_t op_index = 0; op_index < m_nodes.size(); ++op_index)
+    {
+        op_index_map.insert({m_nodes[op_index].get(), op_index});
+    }
+    m_op_successors.resize(m_nodes.size());
+    m_op_dependency_count.resize(m_nodes.size(), 0);
+    for (size_t op_index = 0; op_index < m_nodes.size(); ++op_index)
+    {
+        const shared_ptr<Node>& op = m_nodes[op_index];
+        set<size_t> predecessors;
+        for (auto input : op->inputs())
         {
-            generate_calls(type, *op.get(), op_outputs, op_inputs);
+            predecessors.insert(op_index_map.at(input.get_source_output().get_node()));
         }
-        if (m_performance_counters_enabled)
+        for (auto& control_dependency : op->get_control_dependencies())
         {
-            m_timer_map[op].stop();
+            predecessors.insert(op_index_map.at(control_dependency.get()));
         }
-        if (m_nan_check_enabled)
+        for (size_t predecessor : predecessors)
         {
-            perform_nan_check(op_outputs, op.get());
+            m_op_successors[predecessor].push_back(op_index);
         }
+        m_op_dependency_count[op_index] = predecessors.size();
     }
+}
 
+void runtime::interpreter::INTExecutable::layout_concurrent_memory()
+{
+    // ancestors[i] has bit j set when op j always finishes before op i starts
+    size_t op_count = m_nodes.size();
+    size_t word_count = (op_count + 63) / 64;
+    vector<vector<uint64_t>> ancestors(op_count, vector<uint64_t>(word_count, 0));
+    for (size_t op_index = 0; op_index < op_count; ++op_index)
+    {
+        for (size_t successor : m_op_successors[op_index])
+        {
+            for (size_t word = 0; word < word_count; ++word)
+            {
+                ancestors[successor][word] |= ancestors[op_index][word];
+            }
+            ancestors[successor][op_index / 64] |= uint64_t{1} << (op_index % 64);
+        }
+    }
+    unordered_map<const Node*, size_t> op_index_map;
+    for (size_t op_index = 0; op_index < op_count; ++op_index)
+    {
+        op_index_map.insert({m_nodes[op_index].get(), op_index});
+    }
+
+    // An intermediate may take over a region of the arena only when every op that read the
+    // region's previous value is an ancestor of the op writing it, whatever order the pool
+    // runs independent ops in
+    struct Region
+    {
+        size_t m_offset;
+        size_t m_size;
+        vector<size_t> m_readers;
+    };
+    vector<Region> regions;
+    size_t pool_size = 0;
+    for (size_t op_index = 0; op_index < op_count; ++op_index)
+    {
+        const shared_ptr<Node>& op = m_nodes[op_index];
+        if (op->is_constant() || op->is_parameter() || op->is_output())
+        {
+            continue;
+        }
+        auto finished = [&](size_t reader) {
+            return (ancestors[op_index][reader / 64] >> (reader % 64)) & 1;
+        };
+        for (auto output : op->outputs())
+        {
+            descriptor::Tensor& tensor = output.get_tensor();
+            size_t size = pass::MemoryManager::align(tensor.size(), get_alignment());
+            Region* best = nullptr;
+            for (Region& region : regions)
+            {
+                if (region.m_size >= size && (!best || region.m_size < best->m_size) &&
+                    all_of(region.m_readers.begin(), region.m_readers.end(), finished))
+                {
+                    best = &region;
+                }
+            }
+            if (!best)
+            {
+                regions.push_back(Region{pool_size, size, {}});
+                pool_size += size;
+                best = &regions.back();
+            }
+            tensor.set_pool_offset(best->m_offset);
+            best->m_readers.clear();
+            for (auto& target : output.get_target_inputs())
+            {
+                best->m_readers.push_back(op_index_map.at(target.get_node()));
+            }
+            if (best->m_readers.empty())
+            {
+                best->m_readers.push_back(op_index);
+            }
+        }
+    }
+    m_function->set_temporary_pool_size(pool_size);
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallFrame>
+    runtime::interpreter::INTExecutable::create_call_frame() const
+{
+    unique_ptr<CallFrame> frame(new CallFrame());
+    frame->m_pool.reset(new AlignedBuffer(m_function->get_temporary_pool_size(), get_alignment()));
+    frame->m_tensors.resize(m_tensor_slots.size());
+    for (size_t i = m_external_slot_count; i < m_tensor_slots.size(); ++i)
+    {
+        const descriptor::Tensor* tensor = m_tensor_slots[i].m_tensor;
+        switch (m_tensor_slots[i].m_binding)
+        {
+        case SlotBinding::Pool:
+            frame->m_tensors[i] =
+                make_shared<HostTensor>(tensor->get_element_type(),
+                                        tensor->get_shape(),
+                                        frame->m_pool->get_ptr(tensor->get_pool_offset()),
+                                        tensor->get_name());
+            break;
+        case SlotBinding::Constant: frame->m_tensors[i] = m_tensor_slots[i].m_constant; break;
+        case SlotBinding::External:
+        case SlotBinding::Dynamic: break;
+        }
+    }
+    for (const OpPlan& plan : m_op_plans)
+    {
+        vector<shared_ptr<HostTensor>> op_inputs;
+        for (size_t slot : plan.m_input_slots)
+        {
+            op_inputs.push_back(frame->m_tensors[slot]);
+        }
+        vector<shared_ptr<HostTensor>> op_outputs;
+        for (size_t slot : plan.m_output_slots)
+        {
+            op_outputs.push_back(frame->m_tensors[slot]);
+        }
+        frame->m_op_inputs.push_back(op_inputs);
+        frame->m_op_outputs.push_back(op_outputs);
+    }
+    if (m_thread_pool)
+    {
+        frame->m_pending_dependencies.reset(new atomic<size_t>[m_nodes.size()]);
+    }
+    return frame;
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallFrame>
+    runtime::interpreter::INTExecutable::acquire_call_frame()
+{
+    {
+        lock_guard<mutex> lock(m_call_frame_mutex);
+        if (!m_call_frames.empty())
+        {
+            unique_ptr<CallFrame> frame = move(m_call_frames.back());
+            m_call_frames.pop_back();
+            return frame;
+        }
+    }
+    // Every cached frame is in use by another thread
+    return create_call_frame();
+}
+
+void runtime::interpreter::INTExecutable::release_call_frame(unique_ptr<CallFrame> frame)
+{
+    lock_guard<mutex> lock(m_call_frame_mutex);
+    m_call_frames.push_back(move(frame));
+}
+
+void runtime::interpreter::INTExecutable::bind_call_frame(
+    CallFrame& frame,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs) const
+{
+    size_t input_count = get_parameters().size();
+    for (size_t i = 0; i < input_count; ++i)
+    {
+        frame.m_tensors[i] = static_pointer_cast<runtime::HostTensor>(inputs[i]);
+    }
+    for (size_t i = input_count; i < m_external_slot_count; ++i)
+    {
+        frame.m_tensors[i] = static_pointer_cast<runtime::HostTensor>(outputs[i - input_count]);
+    }
+    // Ops are visited in execution order so a dynamic tensor is always created by its
+    // producer before any consumer is bound to it
+    for (size_t op_index = 0; op_index < m_op_plans.size(); ++op_index)
+    {
+        const OpPlan& plan = m_op_plans[op_index];
+        for (size_t i = 0; i < plan.m_input_slots.size(); ++i)
+        {
+            size_t slot = plan.m_input_slots[i];
+            SlotBinding binding = m_tensor_slots[slot].m_binding;
+            if (binding == SlotBinding::External || binding == SlotBinding::Dynamic)
+            {
+                frame.m_op_inputs[op_index][i] = frame.m_tensors[slot];
+            }
+        }
+        for (size_t i = 0; i < plan.m_output_slots.size(); ++i)
+        {
+            size_t slot = plan.m_output_slots[i];
+            SlotBinding binding = m_tensor_slots[slot].m_binding;
+            if (binding == SlotBinding::Dynamic)
+            {
+                frame.m_tensors[slot] = make_shared<HostTensor>(m_nodes[op_index]->output(i));
+            }
+            if (binding == SlotBinding::External || binding == SlotBinding::Dynamic)
+            {
+                frame.m_op_outputs[op_index][i] = frame.m_tensors[slot];
+            }
+        }
+    }
+}
+
+void runtime::interpreter::INTExecutable::unbind_call_frame(CallFrame& frame) const
+{
+    // Drop the references to caller tensors so an idle frame does not keep them alive
+    for (size_t op_index = 0; op_index < m_op_plans.size(); ++op_index)
+    {
+        const OpPlan& plan = m_op_plans[op_index];
+        for (size_t i = 0; i < plan.m_input_slots.size(); ++i)
+        {
+            SlotBinding binding = m_tensor_slots[plan.m_input_slots[i]].m_binding;
+            if (binding == SlotBinding::External || binding == SlotBinding::Dynamic)
+            {
+                frame.m_op_inputs[op_index][i] = nullptr;
+            }
+        }
+        for (size_t i = 0; i < plan.m_output_slots.size(); ++i)
+        {
+            SlotBinding binding = m_tensor_slots[plan.m_output_slots[i]].m_binding;
+            if (binding == SlotBinding::External || binding == SlotBinding::Dynamic)
+            {
+                frame.m_op_outputs[op_index][i] = nullptr;
+            }
+        }
+    }
+    for (size_t i = 0; i < m_tensor_slots.size(); ++i)
+    {
+        SlotBinding binding = m_tensor_slots[i].m_binding;
+        if (binding == SlotBinding::External || binding == SlotBinding::Dynamic)
+        {
+            frame.m_tensors[i] = nullptr;
+        }
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    static const uint32_t s_trace_name = event::Manager::intern("call");
+    event::Duration d1(s_trace_name, s_trace_category);
+
+    unique_ptr<CallFrame> frame = acquire_call_frame();
+    bind_call_frame(*frame, outputs, inputs);
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> func_inputs(
+            frame->m_tensors.begin(), frame->m_tensors.begin() + get_parameters().size());
+        perform_nan_check(func_inputs);
+    }
+
+    if (m_thread_pool)
+    {
+        run_parallel(*frame);
+    }
+    else
+    {
+        // for each ordered op in the graph
+        for (size_t op_index = 0; op_index < m_nodes.size(); ++op_index)
+        {
+            run_op(*frame, op_index);
+        }
+    }
+
+    unbind_call_frame(*frame);
+    release_call_frame(move(frame));
     return true;
 }
 
+void runtime::interpreter::INTExecutable::run_op(CallFrame& frame, size_t op_index)
+{
+    const shared_ptr<Node>& op = m_nodes[op_index];
+    event::Duration d2(m_trace_names[op_index], s_trace_category);
+    if (op->is_parameter() || op->is_constant())
+    {
+        return;
+    }
+
+    const vector<shared_ptr<HostTensor>>& op_inputs = frame.m_op_inputs[op_index];
+    const vector<shared_ptr<HostTensor>>& op_outputs = frame.m_op_outputs[op_index];
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).start();
+    }
+    if (!op->evaluate(op_outputs, op_inputs))
+    {
+        generate_calls(m_op_plans[op_index].m_type, *op.get(), op_outputs, op_inputs);
+    }
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(op_outputs, op.get());
+    }
+}
+
+void runtime::interpreter::INTExecutable::run_parallel(CallFrame& frame)
+{
+    frame.m_failed = false;
+    frame.m_error = nullptr;
+    frame.m_remaining_ops = m_nodes.size();
+    for (size_t op_index = 0; op_index < m_nodes.size(); ++op_index)
+    {
+        frame.m_pending_dependencies[op_index] = m_op_dependency_count[op_index];
+    }
+    for (size_t op_index = 0; op_index < m_nodes.size(); ++op_index)
+    {
+        if (m_op_dependency_count[op_index] == 0)
+        {
+            schedule_op(frame, op_index);
+        }
+    }
+
+    unique_lock<mutex> lock(frame.m_mutex);
+    frame.m_done.wait(lock, [&frame] { return frame.m_remaining_ops == 0; });
+    if (frame.m_error)
+    {
+        rethrow_exception(frame.m_error);
+    }
+}
+
+void runtime::interpreter::INTExecutable::schedule_op(CallFrame& frame, size_t op_index)
+{
+    m_thread_pool->submit([this, &frame, op_index]() { run_scheduled_op(frame, op_index); });
+}
+
+void runtime::interpreter::INTExecutable::run_scheduled_op(CallFrame& frame, size_t op_index)
+{
+    // After a failure the remaining ops are drained without running so the caller can return
+    if (!frame.m_failed)
+    {
+        try
+        {
+            run_op(frame, op_index);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(frame.m_mutex);
+            if (!frame.m_error)
+            {
+                frame.m_error = current_exception();
+            }
+            frame.m_failed = true;
+        }
+    }
+    for (size_t successor : m_op_successors[op_index])
+    {
+        if (--frame.m_pending_dependencies[successor] == 0)
+        {
+            schedule_op(frame, successor);
+        }
+    }
+    // Decrement under the lock so the caller cannot return and release the frame while this
+    // thread is still using it
+    lock_guard<mutex> lock(frame.m_mutex);
+    if (--frame.m_remaining_ops == 0)
+    {
+        frame.m_done.notify_all();
+    }
+}
+
+namespace
+{
+    int64_t make_positive(int64_t value, size_t dim_size)
+    {
+        return value < 0 ? value + static_cast<int64_t>(dim_size) : value;
+    }
+
+    /// \brief A tensor viewed as outer rows of dim_size parts of inner_bytes each, split on axis
+    struct AxisLayout
+    {
+        AxisLayout(const Shape& shape, size_t axis, size_t element_size)
+            : m_dim_size{shape.at(axis)}
+            , m_inner_bytes{element_size}
+        {
+            for (size_t i = 0; i < axis; ++i)
+            {
+                m_outer_count *= shape[i];
+            }
+            for (size_t i = axis + 1; i < shape.size(); ++i)
+            {
+                m_inner_bytes *= shape[i];
+            }
+        }
+
+        // A part is one block of memory when nothing is outside the axis
+        bool is_contiguous() const { return m_outer_count == 1; }
+        size_t m_outer_count = 1;
+        size_t m_dim_size;
+        size_t m_inner_bytes;
+    };
+
+    /// \brief First index on the axis of the part used by an iteration. With a negative stride
+    /// the parts are walked from start towards the beginning of the axis.
+    size_t part_begin(int64_t start, int64_t stride, int64_t part_size, size_t dim_size, int64_t i)
+    {
+        int64_t begin = make_positive(start, dim_size) + i * stride;
+        if (stride < 0)
+        {
+            begin -= part_size - 1;
+        }
+        NGRAPH_CHECK(begin >= 0 && begin + part_size <= static_cast<int64_t>(dim_size),
+                     "TensorIterator part is out of bounds");
+        return static_cast<size_t>(begin);
+    }
+
+    /// \brief Copies the part_size entries at begin on the axis between a full tensor and a
+    /// tensor holding just that part
+    void copy_part(char* full,
+                   char* part,
+                   const AxisLayout& layout,
+                   size_t begin,
+                   size_t part_size,
+                   bool to_part)
+    {
+        size_t part_bytes = part_size * layout.m_inner_bytes;
+        for (size_t outer = 0; outer < layout.m_outer_count; ++outer)
+        {
+            char* full_row = full + (outer * layout.m_dim_size + begin) * layout.m_inner_bytes;
+            char* part_row = part + outer * part_bytes;
+            if (to_part)
+            {
+                memcpy(part_row, full_row, part_bytes);
+            }
+            else
+            {
+                memcpy(full_row, part_row, part_bytes);
+            }
+        }
+    }
+}
+
+void runtime::interpreter::INTExecutable::run_tensor_iterator(
+    const Node& node,
+    const vector<shared_ptr<HostTensor>>& out,
+    const vector<shared_ptr<HostTensor>>& args)
+{
+    using TensorIterator = op::TensorIterator;
+    const TensorIterator& tensor_iterator = static_cast<const TensorIterator&>(node);
+    const shared_ptr<INTExecutable>& body = m_body_executables.at(&node);
+    const ParameterVector& body_parameters = body->get_parameters();
+    const ResultVector& body_results = body->get_results();
+    int64_t num_iterations = tensor_iterator.get_num_iterations();
+    NGRAPH_CHECK(num_iterations >= 0, "TensorIterator has no iteration count: ", node);
+
+    struct SlicedInput
+    {
+        shared_ptr<TensorIterator::SliceInputDescription> m_description;
+        AxisLayout m_layout;
+        // Holds the gathered part when the part is not contiguous in the input
+        shared_ptr<HostTensor> m_gathered;
+    };
+    struct ConcatOutput
+    {
+        shared_ptr<TensorIterator::ConcatOutputDescription> m_description;
+        AxisLayout m_layout;
+    };
+    struct ResultTargets
+    {
+        vector<ConcatOutput> m_concats;
+        // (iteration, output index) for outputs that take the value from a single iteration
+        vector<pair<int64_t, size_t>> m_iterations;
+        // Alternating buffers for values that are not written into an output directly
+        shared_ptr<HostTensor> m_scratch[2];
+    };
+
+    vector<shared_ptr<Tensor>> body_inputs(body_parameters.size());
+    vector<SlicedInput> sliced_inputs;
+    vector<pair<size_t, size_t>> back_edges;
+    for (const auto& description : tensor_iterator.get_input_descriptions())
+    {
+        const shared_ptr<HostTensor>& arg = args.at(description->m_input_index);
+        const op::Parameter& parameter = *body_parameters.at(description->m_body_parameter_index);
+        if (auto slice = as_type_ptr<TensorIterator::SliceInputDescription>(description))
+        {
+            AxisLayout layout(arg->get_shape(), slice->m_axis, arg->get_element_type().size());
+            shared_ptr<HostTensor> gathered;
+            if (!layout.is_contiguous())
+            {
+                gathered = make_shared<HostTensor>(parameter.get_element_type(),
+                                                   parameter.get_shape());
+                body_inputs[slice->m_body_parameter_index] = gathered;
+            }
+            sliced_inputs.push_back(SlicedInput{slice, layout, gathered});
+        }
+        else
+        {
+            // Invariant inputs keep the caller's tensor and merged inputs start from it
+            body_inputs[description->m_body_parameter_index] = arg;
+            if (auto merged = as_type_ptr<TensorIterator::MergedInputDescription>(description))
+            {
+                back_edges.push_back({merged->m_body_parameter_index, merged->m_body_value_index});
+            }
+        }
+    }
+
+    vector<ResultTargets> targets(body_results.size());
+    for (const auto& description : tensor_iterator.get_output_descriptions())
+    {
+        ResultTargets& target = targets.at(description->m_body_value_index);
+        const shared_ptr<HostTensor>& output = out.at(description->m_output_index);
+        if (auto concat = as_type_ptr<TensorIterator::ConcatOutputDescription>(description))
+        {
+            AxisLayout layout(
+                output->get_shape(), concat->m_axis, output->get_element_type().size());
+            target.m_concats.push_back(ConcatOutput{concat, layout});
+        }
+        else if (auto body_output = as_type_ptr<TensorIterator::BodyOutputDescription>(description))
+        {
+            int64_t iteration = make_positive(body_output->m_iteration, num_iterations);
+            NGRAPH_CHECK(iteration >= 0 && iteration < num_iterations,
+                         "TensorIterator output iteration is out of range: ",
+                         node);
+            target.m_iterations.push_back({iteration, description->m_output_index});
+        }
+    }
+
+    vector<shared_ptr<Tensor>> body_outputs(body_results.size());
+    for (int64_t i = 0; i < num_iterations; ++i)
+    {
+        for (SlicedInput& input : sliced_inputs)
+        {
+            const auto& slice = *input.m_description;
+            char* data = args.at(slice.m_input_index)->get_data_ptr<char>();
+            size_t begin = part_begin(slice.m_start,
+                                      slice.m_stride,
+                                      slice.m_part_size,
+                                      input.m_layout.m_dim_size,
+                                      i);
+            if (input.m_gathered)
+            {
+                copy_part(data,
+                          input.m_gathered->get_data_ptr<char>(),
+                          input.m_layout,
+                          begin,
+                          slice.m_part_size,
+                          true);
+            }
+            else
+            {
+                const op::Parameter& parameter = *body_parameters[slice.m_body_parameter_index];
+                body_inputs[slice.m_body_parameter_index] =
+                    make_shared<HostTensor>(parameter.get_element_type(),
+                                            parameter.get_shape(),
+                                            data + begin * input.m_layout.m_inner_bytes);
+            }
+        }
+
+        // Each result is written straight into the first output slot that can hold it
+        for (size_t r = 0; r < body_results.size(); ++r)
+        {
+            ResultTargets& target = targets[r];
+            const op::Result& result = *body_results[r];
+            shared_ptr<HostTensor> bound;
+            for (const ConcatOutput& concat : target.m_concats)
+            {
+                if (concat.m_layout.is_contiguous())
+                {
+                    const auto& description = *concat.m_description;
+                    size_t begin = part_begin(description.m_start,
+                                              description.m_stride,
+                                              description.m_part_size,
+                                              concat.m_layout.m_dim_size,
+                                              i);
+                    char* data = out[description.m_output_index]->get_data_ptr<char>();
+                    bound = make_shared<HostTensor>(result.get_element_type(),
+                                                    result.get_shape(),
+                                                    data + begin * concat.m_layout.m_inner_bytes);
+                    break;
+                }
+            }
+            for (const pair<int64_t, size_t>& iteration : target.m_iterations)
+            {
+                if (!bound && iteration.first == i)
+                {
+                    bound = out[iteration.second];
+                }
+            }
+            if (!bound)
+            {
+                // The previous iteration's value may still be read through a back edge, so
+                // this iteration writes to the other buffer
+                shared_ptr<HostTensor>& scratch = target.m_scratch[i % 2];
+                if (!scratch)
+                {
+                    scratch =
+                        make_shared<HostTensor>(result.get_element_type(), result.get_shape());
+                }
+                bound = scratch;
+            }
+            body_outputs[r] = bound;
+        }
+
+        body->call(body_outputs, body_inputs);
+
+        // Fill the output slots that could not be bound to the result
+        for (size_t r = 0; r < body_results.size(); ++r)
+        {
+            ResultTargets& target = targets[r];
+            HostTensor& value = static_cast<HostTensor&>(*body_outputs[r]);
+            char* value_data = value.get_data_ptr<char>();
+            for (const ConcatOutput& concat : target.m_concats)
+            {
+                const auto& description = *concat.m_description;
+                size_t begin = part_begin(description.m_start,
+                                          description.m_stride,
+                                          description.m_part_size,
+                                          concat.m_layout.m_dim_size,
+                                          i);
+                char* data = out[description.m_output_index]->get_data_ptr<char>();
+                if (data + begin * concat.m_layout.m_inner_bytes != value_data)
+                {
+                    copy_part(
+                        data, value_data, concat.m_layout, begin, description.m_part_size, false);
+                }
+            }
+            for (const pair<int64_t, size_t>& iteration : target.m_iterations)
+            {
+                char* data = out[iteration.second]->get_data_ptr<char>();
+                if (iteration.first == i && data != value_data)
+                {
+                    memcpy(data, value_data, value.get_size_in_bytes());
+                }
+            }
+        }
+
+        // Back edges hand the tensor the value was written to to the next iteration
+        for (const pair<size_t, size_t>& back_edge : back_edges)
+        {
+            body_inputs[back_edge.first] = body_outputs[back_edge.second];
+        }
+    }
+}
+
 void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
                                                          const Node& op,
                                                          const vector<shared_ptr<HostTensor>>& out,
@@ -245,11 +944,11 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
     case element::Type_t::u16: op_engine<uint16_t>(op, out, in); break;
     case element::Type_t::u32: op_engine<uint32_t>(op, out, in); break;
     case element::Type_t::u64: op_engine<uint64_t>(op, out, in); break;
+    case element::Type_t::bf16: op_engine<bfloat16>(op, out, in); break;
+    case element::Type_t::f16: op_engine<float16>(op, out, in); break;
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
     case element::Type_t::u1:
-    case element::Type_t::bf16:
-    case element::Type_t::f16:
         ss << "unsupported element type " << type << " op " << op.get_name();
         throw ngraph_error(ss.str());
     }
@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -65,9 +70,11 @@
 #include "ngraph/runtime/reference/floor.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/reference/gelu.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
 #include "ngraph/runtime/reference/greater.hpp"
 #include "ngraph/runtime/reference/greater_eq.hpp"
+#include "ngraph/runtime/reference/layer_norm.hpp"
 #include "ngraph/runtime/reference/less.hpp"
 #include "ngraph/runtime/reference/less_eq.hpp"
 #include "ngraph/runtime/reference/log.hpp"
@@ -75,7 +82,9 @@
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
 #include "ngraph/runtime/reference/min.hpp"
+#include "ngraph/runtime/reference/mvn.hpp"
 #include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/normalize_l2.hpp"
 #include "ngraph/runtime/reference/not.hpp"
 #include "ngraph/runtime/reference/not_equal.hpp"
 #include "ngraph/runtime/reference/one_hot.hpp"
@@ -109,6 +118,7 @@
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 
@@ -142,12 +152,24 @@ class INTERPRETER_BACKEND_API ngraph::runtime::interpreter::INTExecutable : publ
     friend class INTBackend;
 
 public:
+    /// \param thread_pool When set, independent ops are dispatched to the pool as soon as
+    ///     their inputs are ready instead of running one at a time in topological order
+    /// \param native_fused_ops Names of the fused ops to run with the interpreter's own kernels
+    ///     instead of decomposing them. Must be a subset of get_native_fused_ops().
     INTExecutable(const std::shared_ptr<Function>& function,
-                  bool enable_performance_collection = false);
+                  bool enable_performance_collection = false,
+                  const std::shared_ptr<ThreadPool>& thread_pool = nullptr,
+                  const std::set<std::string>& native_fused_ops = get_native_fused_ops());
+
+    /// \returns Names of the fused ops the interpreter has kernels for
+    static const std::set<std::string>& get_native_fused_ops();
 
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& inputs) override;
 
+    /// \brief Calls use their own call frame, only the performance counters are shared
+    bool is_reentrant() const override { return !m_performance_counters_enabled; }
+
     virtual void save(std::ostream& output_stream) override;
 
     void set_nan_check(bool enable);
@@ -164,8 +186,14 @@ public:
     std::vector<std::shared_ptr<runtime::Tensor>>
         create_output_tensor(size_t output_index, size_t pipeline_depth) override;
 
+    /// \returns Bytes of the arena each call frame holds intermediate values in
+    size_t get_temporary_pool_size() const { return m_function->get_temporary_pool_size(); }
+
 protected:
-    INTExecutable(const std::string& model_string);
+    /// \brief Loads an executable saved by save(), see the other constructor for the rest
+    INTExecutable(const std::string& model_string,
+                  const std::shared_ptr<ThreadPool>& thread_pool = nullptr,
+                  const std::set<std::string>& native_fused_ops = get_native_fused_ops());
 
     std::shared_ptr<ngraph::op::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ngraph::op::Result> get_result(size_t index) const;
@@ -176,8 +204,95 @@ protected:
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    // Event names of m_nodes, interned once so that tracing an op does not hash its name
+    std::vector<uint32_t> m_trace_names;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
+    std::mutex m_states_mutex;
     std::set<std::string> m_unsupported_op_name_list;
+    std::shared_ptr<ThreadPool> m_thread_pool;
+    std::set<std::string> m_native_fused_ops = get_native_fused_ops();
+    // The body of each TensorIterator in m_nodes, compiled once and run for every iteration
+    std::unordered_map<const Node*, std::shared_ptr<INTExecutable>> m_body_executables;
+
+    /// \brief How the HostTensor for a slot in a CallFrame is provided
+    enum class SlotBinding
+    {
+        // Bound to a caller supplied input or output tensor on every call
+        External,
+        // View into the CallFrame's arena at the offset assigned by pass::MemoryLayout
+        Pool,
+        // View of the data of the Constant producing it, shared by every CallFrame
+        Constant,
+        // Shape is not known at compile time, allocated on every call
+        Dynamic
+    };
+
+    struct TensorSlot
+    {
+        descriptor::Tensor* m_tensor;
+        SlotBinding m_binding;
+        // Set for SlotBinding::Constant
+        std::shared_ptr<HostTensor> m_constant;
+    };
+
+    /// \brief Precomputed tensor slots read and written by one op in m_nodes
+    struct OpPlan
+    {
+        std::vector<size_t> m_input_slots;
+        std::vector<size_t> m_output_slots;
+        element::Type m_type;
+    };
+
+    /// \brief The tensors used by one in-flight call. A CallFrame is built once and reused by
+    /// later calls so steady state calls do not allocate intermediate tensors.
+    struct CallFrame
+    {
+        std::unique_ptr<AlignedBuffer> m_pool;
+        std::vector<std::shared_ptr<HostTensor>> m_tensors;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_outputs;
+
+        // Scheduling state used when ops are dispatched to m_thread_pool
+        std::unique_ptr<std::atomic<size_t>[]> m_pending_dependencies;
+        std::atomic<size_t> m_remaining_ops{0};
+        std::atomic<bool> m_failed{false};
+        std::exception_ptr m_error;
+        std::mutex m_mutex;
+        std::condition_variable m_done;
+    };
+
+    void build_execution_plan();
+    /// \brief Fills m_op_successors and m_op_dependency_count
+    void build_dependency_graph();
+    /// \brief Assigns arena offsets that stay correct under any order the pool runs ops in
+    void layout_concurrent_memory();
+    std::unique_ptr<CallFrame> create_call_frame() const;
+    std::unique_ptr<CallFrame> acquire_call_frame();
+    void release_call_frame(std::unique_ptr<CallFrame> frame);
+    void bind_call_frame(CallFrame& frame,
+                         const std::vector<std::shared_ptr<Tensor>>& outputs,
+                         const std::vector<std::shared_ptr<Tensor>>& inputs) const;
+    void unbind_call_frame(CallFrame& frame) const;
+    void run_op(CallFrame& frame, size_t op_index);
+    void run_parallel(CallFrame& frame);
+    void schedule_op(CallFrame& frame, size_t op_index);
+    void run_scheduled_op(CallFrame& frame, size_t op_index);
+    /// \brief Runs the compiled body of a TensorIterator once per iteration. Sliced inputs,
+    /// back edges and concatenated outputs are bound by pointer wherever the slice is
+    /// contiguous, so an iteration only copies the slices that are strided in memory.
+    void run_tensor_iterator(const Node& node,
+                             const std::vector<std::shared_ptr<HostTensor>>& out,
+                             const std::vector<std::shared_ptr<HostTensor>>& args);
+
+    // Slots [0, parameter count) hold the inputs, followed by one slot per result
+    std::vector<TensorSlot> m_tensor_slots;
+    size_t m_external_slot_count = 0;
+    std::vector<OpPlan> m_op_plans;
+    // Dependency graph over m_nodes used by the parallel scheduler
+    std::vector<std::vector<size_t>> m_op_successors;
+    std::vector<size_t> m_op_dependency_count;
+    std::mutex m_call_frame_mutex;
+    std::vector<std::unique_ptr<CallFrame>> m_call_frames;
 
     static OP_TYPEID get_typeid(const Node& node);
 
@@ -353,16 +468,20 @@ protected:
         case OP_TYPEID::GenerateMask:
         {
             bool use_seed = static_cast<bool>(args[2]->get_data_ptr<const int32_t>()[0]);
-            if (m_states.count(&node) == 0)
+            BernoulliRNGState* state;
             {
-                const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
-                auto seed = use_seed ? gm->get_seed() : 0;
-                m_states[&node] =
-                    std::unique_ptr<State>(new BernoulliRNGState(seed, gm->get_probability()));
+                std::lock_guard<std::mutex> lock(m_states_mutex);
+                if (m_states.count(&node) == 0)
+                {
+                    const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
+                    auto seed = use_seed ? gm->get_seed() : 0;
+                    m_states[&node] =
+                        std::unique_ptr<State>(new BernoulliRNGState(seed, gm->get_probability()));
+                }
+                state = static_cast<BernoulliRNGState*>(m_states.at(&node).get());
             }
 
             bool training = static_cast<bool>(args[0]->get_data_ptr<const T>()[0]);
-            auto state = static_cast<BernoulliRNGState*>(m_states.at(&node).get());
             size_t element_count = shape_size(node.get_output_shape(0));
             if (!use_seed)
             {
@@ -588,11 +707,19 @@ protected:
                                       out[0]->get_data_ptr<uint64_t>(),
                                       element_count);
                 break;
+            case element::Type_t::bf16:
+                reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<bfloat16>(),
+                                      element_count);
+                break;
+            case element::Type_t::f16:
+                reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<float16>(),
+                                      element_count);
+                break;
             case element::Type_t::undefined:
             case element::Type_t::dynamic:
             case element::Type_t::u1:
-            case element::Type_t::bf16:
-            case element::Type_t::f16:
                 ss << "unsupported element type " << type << " op Convert";
                 throw std::runtime_error(ss.str());
             }
@@ -893,6 +1020,13 @@ protected:
             }
             break;
         }
+        case OP_TYPEID::Gelu:
+        {
+            size_t element_count = shape_size(node.get_output_shape(0));
+            reference::gelu<T>(
+                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            break;
+        }
         case OP_TYPEID::Greater:
         {
             auto greater = static_cast<const op::Greater*>(&node);
@@ -915,6 +1049,28 @@ protected:
                                      greater_eq->get_autob());
             break;
         }
+        case OP_TYPEID::LayerNorm:
+        {
+            const op::LayerNorm* layer_norm = static_cast<const op::LayerNorm*>(&node);
+            const Shape& shape = node.get_input_shape(0);
+            int64_t begin_norm_axis = layer_norm->get_begin_norm_axis();
+            if (begin_norm_axis < 0)
+            {
+                begin_norm_axis += static_cast<int64_t>(shape.size());
+            }
+            bool use_affine = layer_norm->get_use_affine();
+            bool keep_stats = layer_norm->get_keep_stats();
+            reference::layer_norm<T>(args[0]->get_data_ptr<const T>(),
+                                     use_affine ? args[1]->get_data_ptr<const T>() : nullptr,
+                                     use_affine ? args[2]->get_data_ptr<const T>() : nullptr,
+                                     out[0]->get_data_ptr<T>(),
+                                     keep_stats ? out[1]->get_data_ptr<T>() : nullptr,
+                                     keep_stats ? out[2]->get_data_ptr<T>() : nullptr,
+                                     shape,
+                                     static_cast<size_t>(begin_norm_axis),
+                                     layer_norm->get_epsilon());
+            break;
+        }
         case OP_TYPEID::Less:
         {
             auto less = static_cast<const op::Less*>(&node);
@@ -1051,6 +1207,17 @@ protected:
                               min->get_reduction_axes());
             break;
         }
+        case OP_TYPEID::MVN:
+        {
+            const op::MVN* mvn = static_cast<const op::MVN*>(&node);
+            reference::mvn<T>(args[0]->get_data_ptr<const T>(),
+                              out[0]->get_data_ptr<T>(),
+                              node.get_input_shape(0),
+                              mvn->get_reduction_axes(),
+                              mvn->get_normalize_variance(),
+                              mvn->get_eps());
+            break;
+        }
         case OP_TYPEID::Negative:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -1058,6 +1225,17 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::NormalizeL2:
+        {
+            const op::NormalizeL2* normalize_l2 = static_cast<const op::NormalizeL2*>(&node);
+            reference::normalize_l2<T>(args[0]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       node.get_input_shape(0),
+                                       normalize_l2->get_reduction_axes(),
+                                       normalize_l2->get_eps(),
+                                       normalize_l2->get_eps_mode());
+            break;
+        }
         case OP_TYPEID::LogicalNot_v1:
         case OP_TYPEID::Not:
         {
@@ -1395,12 +1573,15 @@ protected:
             // static output shapes anyway.
             bool use_fixed_seed = static_cast<bool>(args[3]->get_data_ptr<const char>()[0]);
 
-            if (m_states.count(&node) == 0)
+            UniformRNGState* state;
             {
-                m_states[&node] = std::unique_ptr<UniformRNGState>(new UniformRNGState());
+                std::lock_guard<std::mutex> lock(m_states_mutex);
+                if (m_states.count(&node) == 0)
+                {
+                    m_states[&node] = std::unique_ptr<UniformRNGState>(new UniformRNGState());
+                }
+                state = static_cast<UniformRNGState*>(m_states.at(&node).get());
             }
-
-            auto state = static_cast<UniformRNGState*>(m_states.at(&node).get());
             size_t element_count = shape_size(node.get_output_shape(0));
             if (!use_fixed_seed)
             {
@@ -1657,6 +1838,11 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::TensorIterator:
+        {
+            run_tensor_iterator(node, out, args);
+            break;
+        }
         case OP_TYPEID::TopK:
         {
             const op::TopK* topk = static_cast<const op::TopK*>(&node);
@@ -1718,7 +1904,6 @@ protected:
         case OP_TYPEID::DynSlice:
         case OP_TYPEID::Elu:
         case OP_TYPEID::FakeQuantize:
-        case OP_TYPEID::Gelu:
         case OP_TYPEID::GeluBackpropFactor:
         case OP_TYPEID::Gemm:
         case OP_TYPEID::GRN:
@@ -1728,13 +1913,10 @@ protected:
         case OP_TYPEID::GRUCell:
         case OP_TYPEID::HardSigmoid:
         case OP_TYPEID::Interpolate:
-        case OP_TYPEID::LayerNorm:
         case OP_TYPEID::LayerNormBackprop:
         case OP_TYPEID::LSTMCell:
         case OP_TYPEID::LSTMSequence:
         case OP_TYPEID::MatMul:
-        case OP_TYPEID::MVN:
-        case OP_TYPEID::NormalizeL2:
         case OP_TYPEID::PartialSlice:
         case OP_TYPEID::PartialSliceBackprop:
         case OP_TYPEID::Passthrough:
@@ -1753,7 +1935,6 @@ protected:
         case OP_TYPEID::Squeeze:
         case OP_TYPEID::Stack:
         case OP_TYPEID::StopGradient:
-        case OP_TYPEID::TensorIterator:
         case OP_TYPEID::Tile:
         case OP_TYPEID::UnknownOp:
         case OP_TYPEID::Unsqueeze:
@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/mapped_file.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef _WIN32
+runtime::MappedFile::MappedFile(const string& path)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_file(INVALID_HANDLE_VALUE)
+    , m_mapping(nullptr)
+{
+    m_file = CreateFileA(path.c_str(),
+                         GENERIC_READ,
+                         FILE_SHARE_READ,
+                         nullptr,
+                         OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL,
+                         nullptr);
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        throw ngraph_error("Failed to open '" + path + "' for mapping");
+    }
+    LARGE_INTEGER file_size;
+    GetFileSizeEx(m_file, &file_size);
+    m_size = static_cast<size_t>(file_size.QuadPart);
+    if (m_size > 0)
+    {
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (m_mapping != nullptr)
+        {
+            m_data = static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0));
+        }
+        if (m_data == nullptr)
+        {
+            if (m_mapping != nullptr)
+            {
+                CloseHandle(m_mapping);
+            }
+            CloseHandle(m_file);
+            throw ngraph_error("Failed to map '" + path + "'");
+        }
+    }
+}
+
+runtime::MappedFile::~MappedFile()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping != nullptr)
+    {
+        CloseHandle(m_mapping);
+    }
+    CloseHandle(m_file);
+}
+#else
+runtime::MappedFile::MappedFile(const string& path)
+    : m_data(nullptr)
+    , m_size(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw ngraph_error("Failed to open '" + path + "' for mapping");
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        throw ngraph_error("Failed to stat '" + path + "'");
+    }
+    m_size = static_cast<size_t>(st.st_size);
+    if (m_size > 0)
+    {
+        void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw ngraph_error("Failed to map '" + path + "'");
+        }
+        m_data = static_cast<char*>(data);
+    }
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+}
+
+runtime::MappedFile::~MappedFile()
+{
+    if (m_data != nullptr)
+    {
+        munmap(m_data, m_size);
+    }
+}
+#endif
@@ -18,8 +18,10 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/shape_util.hpp"
+#include "ngraph/axis_set.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -53,15 +55,24 @@ namespace ngraph
                         adjusted_axes.insert(axis);
                     }
                 }
-                CoordinateTransform input_transform(adjusted_in_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
+                // Remaining output axes map in order onto the adjusted input axes; broadcast axes
+                // do not move through the input at all.
+                std::vector<std::ptrdiff_t> adjusted_in_strides =
+                    StridedWalk::row_major_strides(adjusted_in_shape);
+                std::vector<std::ptrdiff_t> in_strides(out_shape.size(), 0);
+                size_t in_axis = 0;
+                for (size_t axis = 0; axis < out_shape.size(); ++axis)
                 {
-                    Coordinate input_coord = reduce(output_coord, adjusted_axes);
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                    if (adjusted_axes.count(axis) == 0)
+                    {
+                        NGRAPH_CHECK(in_axis < adjusted_in_shape.size());
+                        in_strides[axis] = adjusted_in_strides[in_axis++];
+                    }
                 }
+                NGRAPH_CHECK(in_axis == adjusted_in_shape.size());
+
+                StridedWalk walk(out_shape, in_strides, StridedWalk::row_major_strides(out_shape));
+                walk.copy(arg, out);
             }
         }
     }
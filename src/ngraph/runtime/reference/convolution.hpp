@@ -16,13 +16,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <functional>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/reference/widen.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -31,27 +35,28 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
-            struct widen
-            {
-                using type = T;
-            };
-
-            template <>
-            struct widen<float>
-            {
-                using type = double;
-            };
-
-            template <>
-            struct widen<double>
-            {
-                using type = long double;
-            };
-
             // in: NC_I...
             // filter: C_OC_I...
             // out: NC_O...
+            //
+            // Each batch is the matrix product
+            //
+            //   out[chan_out, o] = sum_k w[chan_out, k] * col[k, o]
+            //
+            // where o runs over the output spatial positions and k over the (filter tap,
+            // chan_in) pairs, taps outermost. col is the im2col unrolling of the input: column o
+            // holds every input value the filter touches at o, with zero wherever a tap lands
+            // in the padding or in a dilation gap. Output positions are unrolled a block at a
+            // time so the scratch buffer stays small, and the product is done by the blocked
+            // dot_row_major kernel. Two cases skip the unrolling:
+            //
+            // * a 1x1 filter with unit strides and no padding or dilation reads the input in
+            //   place, since each batch of the input already is the [chan_in, o] matrix.
+            // * a single input channel, which is what each group of a depthwise convolution
+            //   becomes, walks the taps directly over a block of output positions.
+            //
+            // Every output still sums its products in (tap, chan_in) order, exactly like a
+            // walk over the padded and dilated input, so results do not depend on the path.
             template <typename INPUT,
                       typename FILTER,
                       typename OUTPUT,
@@ -87,178 +92,273 @@ namespace ngraph
                     is_quantized = true;
                 }
 
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
-                // Comments throughout assume without loss of generality that:
-                //
-                // * batch axes for both in and out are 0
-                // * in channel axes for both in and filter are 1
-                // * out channel axes for filter is 0
-                // * out channel axis for out is 1
 
-                // At the outermost level we will walk over every out coordinate O.
-                CoordinateTransform out_transform(out_shape);
-
-                for (const Coordinate& out_coord : out_transform)
+                const ACCUMULATION in_zero_point =
+                    is_quantized ? static_cast<ACCUMULATION>(*input_zero_point) : 0;
+                const ACCUMULATION filter_zero =
+                    is_quantized ? static_cast<ACCUMULATION>(*filter_zero_point) : 0;
+                const float scale =
+                    is_quantized ? *input_scale * *filter_scale / *output_scale : 1.0f;
+                auto store = [&](size_t out_idx, ACCUMULATION result) {
+                    if (is_quantized)
+                    {
+                        out[out_idx] =
+                            static_cast<OUTPUT>(std::round(static_cast<float>(result) * scale)) +
+                            *output_zero_point;
+                    }
+                    else
+                    {
+                        out[out_idx] = static_cast<OUTPUT>(result);
+                    }
+                };
+
+                const size_t n_spatial_dimensions = in_shape.size() - 2;
+                const size_t n_batches = out_shape[out_batch_axis];
+                const size_t n_in_channels = in_shape[in_channel_axis];
+                const size_t n_out_channels = out_shape[out_channel_axis];
+
+                const Strides in_strides = row_major_strides(in_shape);
+                const Strides filter_strides = row_major_strides(filter_shape);
+                const Strides out_strides = row_major_strides(out_shape);
+
+                // For every spatial axis, the input offset reached by each (output position,
+                // tap) pair, or -1 if the tap lands in the padding or in a dilation gap.
+                std::vector<std::vector<std::ptrdiff_t>> axis_offsets(n_spatial_dimensions);
+                size_t n_positions = 1;
+                size_t n_taps = 1;
+                bool is_pointwise = in_batch_axis == 0 && in_channel_axis == 1 &&
+                                    filter_out_channel_axis == 0 && filter_in_channel_axis == 1 &&
+                                    out_batch_axis == 0 && out_channel_axis == 1;
+                for (size_t i = 0; i < n_spatial_dimensions; ++i)
                 {
-                    // Our out coordinate O will have the form:
-                    //
-                    //   (N,chan_out,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[out_batch_axis];
-                    size_t out_channel = out_coord[out_channel_axis];
-
-                    // For the in we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,0,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,
-                    //      chans_in_count,
-                    //      s_1*i_1+ l_1*filter_dims_1,
-                    ///       ...,
-                    ///     s_n*i_n +l_n*filter_dims_n)
-                    //
-                    // with strides:
-                    //
-                    //   (1,l_1,...,l_n).
-                    //
-                    // Note that we are iterating within the *padded* and *dilated* in batch, so
-                    // further down we must check the current coordinate is in the pad or dilation
-                    // gap.
-
-                    size_t n_spatial_dimensions = in_shape.size() - 2;
-                    size_t n_in_channels = in_shape[in_channel_axis];
-
-                    Coordinate in_transform_start(2 + n_spatial_dimensions);
-                    Coordinate in_transform_end(2 + n_spatial_dimensions);
-                    Strides in_transform_movement_strides(2 + n_spatial_dimensions, 1);
-                    CoordinateDiff in_transform_pad_below(2 + n_spatial_dimensions, 0);
-                    CoordinateDiff in_transform_pad_above(2 + n_spatial_dimensions, 0);
-                    Strides in_transform_dilation_strides(2 + n_spatial_dimensions, 1);
-
-                    in_transform_start[in_batch_axis] = batch_index;
-                    in_transform_end[in_batch_axis] = batch_index + 1;
-                    in_transform_start[in_channel_axis] = 0;
-                    in_transform_end[in_channel_axis] = 1;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                    const size_t out_dim = out_shape[i + 2];
+                    const size_t filter_dim = filter_shape[i + 2];
+                    const std::ptrdiff_t dilation = in_dilation[i];
+                    const std::ptrdiff_t in_dim = in_shape[i + 2];
+                    const std::ptrdiff_t in_axis_stride = in_strides[i + 2];
+                    const std::ptrdiff_t dilated_in_dim =
+                        in_dim == 0 ? 0 : (in_dim - 1) * dilation + 1;
+                    std::vector<std::ptrdiff_t>& offsets = axis_offsets[i];
+                    offsets.resize(out_dim * filter_dim);
+                    for (size_t o = 0; o < out_dim; ++o)
                     {
-                        size_t filter_dilation_stride = filter_dilation[i - 2];
-                        size_t filter_movement_stride = stride[i - 2];
-                        std::ptrdiff_t below_pad = in_pad_below[i - 2];
-                        std::ptrdiff_t above_pad = in_pad_above[i - 2];
-                        size_t in_dilation_stride = in_dilation[i - 2];
-
-                        in_transform_start[i] = filter_movement_stride * out_coord[i];
-                        in_transform_end[i] = in_transform_start[i] +
-                                              (filter_shape[i] - 1) * filter_dilation_stride + 1;
-                        in_transform_movement_strides[i] = filter_dilation_stride;
-                        in_transform_pad_below[i] = below_pad;
-                        in_transform_pad_above[i] = above_pad;
-                        in_transform_dilation_strides[i] = in_dilation_stride;
+                        for (size_t f = 0; f < filter_dim; ++f)
+                        {
+                            std::ptrdiff_t pos = static_cast<std::ptrdiff_t>(
+                                                     o * stride[i] + f * filter_dilation[i]) -
+                                                 in_pad_below[i];
+                            bool in_bounds =
+                                pos >= 0 && pos < dilated_in_dim && pos % dilation == 0;
+                            offsets[o * filter_dim + f] =
+                                in_bounds ? pos / dilation * in_axis_stride : -1;
+                        }
                     }
+                    n_positions *= out_dim;
+                    n_taps *= filter_dim;
+                    is_pointwise = is_pointwise && filter_dim == 1 && stride[i] == 1 &&
+                                   dilation == 1 && in_pad_below[i] == 0 &&
+                                   in_pad_above[i] == 0;
+                }
 
-                    AxisVector in_transform_axis_order(2 + n_spatial_dimensions);
-                    for (size_t i = 0; i < in_transform_axis_order.size(); i++)
+                if (is_pointwise)
+                {
+                    for (size_t batch = 0; batch < n_batches; ++batch)
                     {
-                        in_transform_axis_order[i] = i;
+                        const INPUT* in_batch = in + batch * in_strides[0];
+                        OUTPUT* out_batch = out + batch * out_strides[0];
+                        if (is_quantized)
+                        {
+                            dot_row_major<FILTER, INPUT, OUTPUT, ACCUMULATION>(filter,
+                                                                               in_batch,
+                                                                               out_batch,
+                                                                               n_out_channels,
+                                                                               n_in_channels,
+                                                                               n_positions,
+                                                                               filter_zero,
+                                                                               in_zero_point,
+                                                                               &scale,
+                                                                               output_zero_point);
+                        }
+                        else
+                        {
+                            dot_row_major<FILTER, INPUT, OUTPUT, ACCUMULATION>(
+                                filter, in_batch, out_batch, n_out_channels, n_in_channels,
+                                n_positions);
+                        }
                     }
-                    CoordinateTransform in_transform(in_shape,
-                                                     in_transform_start,
-                                                     in_transform_end,
-                                                     in_transform_movement_strides,
-                                                     in_transform_axis_order,
-                                                     in_transform_pad_below,
-                                                     in_transform_pad_above,
-                                                     in_transform_dilation_strides);
-
-                    // Simultaneously with iterating I, for the filter we need to iterate the
-                    // coordinate:
-                    //
-                    //   F
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (chan_out,0,0,...,0) ->
-                    //     (chan_out+1,
-                    //      chans_in_count,
-                    //      filter_dims_1,
-                    //        ...,
-                    //      filter_dims_n)
-                    //
-                    // with unit stride.
-
-                    Shape filter_transform_start(2 + n_spatial_dimensions);
-                    Shape filter_transform_end(2 + n_spatial_dimensions);
-
-                    filter_transform_start[filter_out_channel_axis] = out_channel;
-                    filter_transform_end[filter_out_channel_axis] = out_channel + 1;
-                    filter_transform_start[filter_in_channel_axis] = 0;
-                    filter_transform_end[filter_in_channel_axis] = 1;
+                    std::fesetround(old_mode);
+                    return;
+                }
 
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                // The spatial coordinates of every output position and filter tap, row-major.
+                std::vector<size_t> position_coords(n_positions * n_spatial_dimensions);
+                std::vector<size_t> tap_coords(n_taps * n_spatial_dimensions);
+                for (size_t p = 0; p < n_positions; ++p)
+                {
+                    for (size_t i = n_spatial_dimensions, rest = p; i-- > 0;)
                     {
-                        filter_transform_start[i] = 0;
-                        filter_transform_end[i] = filter_shape[i];
+                        position_coords[p * n_spatial_dimensions + i] = rest % out_shape[i + 2];
+                        rest /= out_shape[i + 2];
                     }
+                }
+                for (size_t t = 0; t < n_taps; ++t)
+                {
+                    for (size_t i = n_spatial_dimensions, rest = t; i-- > 0;)
+                    {
+                        tap_coords[t * n_spatial_dimensions + i] = rest % filter_shape[i + 2];
+                        rest /= filter_shape[i + 2];
+                    }
+                }
 
-                    CoordinateTransform filter_transform(
-                        filter_shape, filter_transform_start, filter_transform_end);
-
-                    // As we go, we sum up:
-                    //
-                    //   out[O] += in[I] * filter[F].
-
-                    ACCUMULATION result = 0;
-
-                    CoordinateTransform::Iterator in_it = in_transform.begin();
-                    CoordinateTransform::Iterator filter_it = filter_transform.begin();
-                    CoordinateTransform::Iterator in_it_end = in_transform.end();
-                    CoordinateTransform::Iterator filter_it_end = filter_transform.end();
-
-                    size_t in_channel_stride = row_major_strides(in_shape).at(in_channel_axis);
-                    size_t filter_in_channel_stride =
-                        row_major_strides(filter_shape).at(filter_in_channel_axis);
-
-                    while (in_it != in_it_end && filter_it != filter_it_end)
+                // The spatial axes are the trailing axes of every tensor, so a position or tap
+                // index is also its offset within one (batch, channel) slice.
+                const size_t in_batch_stride = in_strides[in_batch_axis];
+                const size_t in_channel_stride = in_strides[in_channel_axis];
+                const size_t filter_out_channel_stride = filter_strides[filter_out_channel_axis];
+                const size_t filter_in_channel_stride = filter_strides[filter_in_channel_axis];
+                const size_t out_batch_stride = out_strides[out_batch_axis];
+                const size_t out_channel_stride = out_strides[out_channel_axis];
+                const size_t k_size = n_taps * n_in_channels;
+
+                // The filter as a [chan_out, (tap, chan_in)] matrix.
+                std::vector<ACCUMULATION> weights;
+                if (n_in_channels != 1)
+                {
+                    weights.resize(n_out_channels * k_size);
+                    for (size_t out_channel = 0; out_channel < n_out_channels; ++out_channel)
                     {
-                        const Coordinate& in_coord = *in_it;
-                        if (in_transform.has_source_coordinate(in_coord))
+                        for (size_t t = 0; t < n_taps; ++t)
                         {
-                            size_t in_idx = in_transform.index(in_coord);
-                            const Coordinate& filter_coord = *filter_it;
-                            size_t filter_idx = filter_transform.index(filter_coord);
                             for (size_t in_channel = 0; in_channel < n_in_channels; ++in_channel)
                             {
-                                ACCUMULATION in_v = static_cast<ACCUMULATION>(in[in_idx]);
-                                ACCUMULATION f_v = static_cast<ACCUMULATION>(filter[filter_idx]);
-                                if (is_quantized)
-                                {
-                                    in_v = in_v - static_cast<ACCUMULATION>(*input_zero_point);
-                                    f_v = f_v - static_cast<ACCUMULATION>(*filter_zero_point);
-                                }
-                                result += in_v * f_v;
-                                in_idx += in_channel_stride;
-                                filter_idx += filter_in_channel_stride;
+                                weights[out_channel * k_size + t * n_in_channels + in_channel] =
+                                    static_cast<ACCUMULATION>(
+                                        filter[out_channel * filter_out_channel_stride +
+                                               in_channel * filter_in_channel_stride + t]) -
+                                    filter_zero;
                             }
                         }
-                        ++in_it;
-                        ++filter_it;
                     }
-                    if (is_quantized)
+                }
+
+                constexpr size_t position_block = 256;
+                std::vector<std::ptrdiff_t> tap_offsets(n_taps * position_block);
+                std::vector<ACCUMULATION> col;
+                std::vector<ACCUMULATION> tile;
+                if (n_in_channels == 1)
+                {
+                    tile.resize(position_block);
+                }
+                else
+                {
+                    col.resize(k_size * position_block);
+                    tile.resize(n_out_channels * position_block);
+                }
+
+                for (size_t p_begin = 0; p_begin < n_positions; p_begin += position_block)
+                {
+                    const size_t p_count = std::min(position_block, n_positions - p_begin);
+                    for (size_t t = 0; t < n_taps; ++t)
                     {
-                        float scale = *input_scale * *filter_scale / *output_scale;
-                        out[out_transform.index(out_coord)] =
-                            static_cast<OUTPUT>(std::round(static_cast<float>(result) * scale)) +
-                            *output_zero_point;
+                        const size_t* tap = &tap_coords[t * n_spatial_dimensions];
+                        for (size_t p = 0; p < p_count; ++p)
+                        {
+                            const size_t* position =
+                                &position_coords[(p_begin + p) * n_spatial_dimensions];
+                            std::ptrdiff_t offset = 0;
+                            for (size_t i = 0; i < n_spatial_dimensions && offset >= 0; ++i)
+                            {
+                                std::ptrdiff_t axis_offset =
+                                    axis_offsets[i][position[i] * filter_shape[i + 2] + tap[i]];
+                                offset = axis_offset < 0 ? -1 : offset + axis_offset;
+                            }
+                            tap_offsets[t * p_count + p] = offset;
+                        }
                     }
-                    else
+
+                    for (size_t batch = 0; batch < n_batches; ++batch)
                     {
-                        out[out_transform.index(out_coord)] = result;
+                        const INPUT* in_batch = in + batch * in_batch_stride;
+                        const size_t out_base = batch * out_batch_stride + p_begin;
+                        if (n_in_channels == 1)
+                        {
+                            for (size_t out_channel = 0; out_channel < n_out_channels;
+                                 ++out_channel)
+                            {
+                                const FILTER* taps =
+                                    filter + out_channel * filter_out_channel_stride;
+                                std::fill(tile.begin(), tile.begin() + p_count, ACCUMULATION(0));
+                                for (size_t t = 0; t < n_taps; ++t)
+                                {
+                                    const ACCUMULATION f_v =
+                                        static_cast<ACCUMULATION>(taps[t]) - filter_zero;
+                                    const std::ptrdiff_t* offsets = &tap_offsets[t * p_count];
+                                    for (size_t p = 0; p < p_count; ++p)
+                                    {
+                                        if (offsets[p] >= 0)
+                                        {
+                                            ACCUMULATION in_v =
+                                                static_cast<ACCUMULATION>(in_batch[offsets[p]]) -
+                                                in_zero_point;
+                                            tile[p] += in_v * f_v;
+                                        }
+                                    }
+                                }
+                                for (size_t p = 0; p < p_count; ++p)
+                                {
+                                    store(out_base + out_channel * out_channel_stride + p,
+                                          tile[p]);
+                                }
+                            }
+                        }
+                        else
+                        {
+                            for (size_t t = 0; t < n_taps; ++t)
+                            {
+                                const std::ptrdiff_t* offsets = &tap_offsets[t * p_count];
+                                for (size_t in_channel = 0; in_channel < n_in_channels;
+                                     ++in_channel)
+                                {
+                                    const INPUT* in_channel_data =
+                                        in_batch + in_channel * in_channel_stride;
+                                    ACCUMULATION* row =
+                                        &col[(t * n_in_channels + in_channel) * p_count];
+                                    for (size_t p = 0; p < p_count; ++p)
+                                    {
+                                        row[p] = offsets[p] < 0
+                                                     ? ACCUMULATION(0)
+                                                     : static_cast<ACCUMULATION>(
+                                                           in_channel_data[offsets[p]]) -
+                                                           in_zero_point;
+                                    }
+                                }
+                            }
+                            dot_row_major<ACCUMULATION,
+                                          ACCUMULATION,
+                                          ACCUMULATION,
+                                          ACCUMULATION>(weights.data(),
+                                                        col.data(),
+                                                        tile.data(),
+                                                        n_out_channels,
+                                                        k_size,
+                                                        p_count);
+                            for (size_t out_channel = 0; out_channel < n_out_channels;
+                                 ++out_channel)
+                            {
+                                for (size_t p = 0; p < p_count; ++p)
+                                {
+                                    store(out_base + out_channel * out_channel_stride + p,
+                                          tile[out_channel * p_count + p]);
+                                }
+                            }
+                        }
                     }
                 }
                 std::fesetround(old_mode);
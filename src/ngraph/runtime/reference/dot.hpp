@@ -16,13 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cfenv>
 #include <cmath>
 #include <utility>
 
-#include <cfenv>
-#include <functional>
-#include "convolution.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/widen.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,6 +30,107 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Row-major matrix product out[m, n] = sum_k arg0[m, k] * arg1[k, n].
+            ///
+            /// Every dot is a matrix product once the projected and dotted axes are flattened,
+            /// since the dotted axes are the trailing axes of arg0 and the leading axes of arg1.
+            /// Columns are processed in blocks so a panel of arg1 stays in cache while it is
+            /// reused by every row, and rows are processed several at a time so each loaded
+            /// element of arg1 feeds more than one accumulator. The innermost loop runs over
+            /// contiguous columns so the compiler can vectorize it. Each output still sums its
+            /// products in increasing k order, so results match a naive loop exactly.
+            template <typename INPUT0,
+                      typename INPUT1,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void dot_row_major(const INPUT0* arg0,
+                               const INPUT1* arg1,
+                               OUTPUT* out,
+                               size_t m_size,
+                               size_t k_size,
+                               size_t n_size,
+                               ACCUMULATION input0_zero_point = 0,
+                               ACCUMULATION input1_zero_point = 0,
+                               const float* output_scale = nullptr,
+                               const OUTPUT* output_zero_point = nullptr)
+            {
+                constexpr size_t row_tile = 4;
+                constexpr size_t column_block = 64;
+                ACCUMULATION acc[row_tile][column_block];
+
+                for (size_t n_begin = 0; n_begin < n_size; n_begin += column_block)
+                {
+                    const size_t n_count = std::min(column_block, n_size - n_begin);
+                    for (size_t m_begin = 0; m_begin < m_size; m_begin += row_tile)
+                    {
+                        const size_t m_count = std::min(row_tile, m_size - m_begin);
+                        for (size_t r = 0; r < m_count; ++r)
+                        {
+                            std::fill(acc[r], acc[r] + n_count, ACCUMULATION(0));
+                        }
+                        if (input0_zero_point == 0 && input1_zero_point == 0)
+                        {
+                            for (size_t k = 0; k < k_size; ++k)
+                            {
+                                const INPUT1* b = arg1 + k * n_size + n_begin;
+                                for (size_t r = 0; r < m_count; ++r)
+                                {
+                                    const ACCUMULATION a = static_cast<ACCUMULATION>(
+                                        arg0[(m_begin + r) * k_size + k]);
+                                    ACCUMULATION* acc_row = acc[r];
+                                    for (size_t n = 0; n < n_count; ++n)
+                                    {
+                                        acc_row[n] += a * static_cast<ACCUMULATION>(b[n]);
+                                    }
+                                }
+                            }
+                        }
+                        else
+                        {
+                            for (size_t k = 0; k < k_size; ++k)
+                            {
+                                const INPUT1* b = arg1 + k * n_size + n_begin;
+                                for (size_t r = 0; r < m_count; ++r)
+                                {
+                                    const ACCUMULATION a =
+                                        static_cast<ACCUMULATION>(
+                                            arg0[(m_begin + r) * k_size + k]) -
+                                        input0_zero_point;
+                                    ACCUMULATION* acc_row = acc[r];
+                                    for (size_t n = 0; n < n_count; ++n)
+                                    {
+                                        acc_row[n] += a * (static_cast<ACCUMULATION>(b[n]) -
+                                                           input1_zero_point);
+                                    }
+                                }
+                            }
+                        }
+                        for (size_t r = 0; r < m_count; ++r)
+                        {
+                            OUTPUT* out_row = out + (m_begin + r) * n_size + n_begin;
+                            if (output_zero_point)
+                            {
+                                // Requantize, output_scale already folds in the input scales
+                                for (size_t n = 0; n < n_count; ++n)
+                                {
+                                    out_row[n] = static_cast<OUTPUT>(std::round(
+                                                     static_cast<float>(acc[r][n]) *
+                                                     *output_scale)) +
+                                                 *output_zero_point;
+                                }
+                            }
+                            else
+                            {
+                                for (size_t n = 0; n < n_count; ++n)
+                                {
+                                    out_row[n] = static_cast<OUTPUT>(acc[r][n]);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             template <typename INPUT0,
                       typename INPUT1,
                       typename OUTPUT,
@@ -56,114 +156,49 @@ namespace ngraph
                     is_quantized = true;
                 }
 
-                auto old_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
-                // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
-                // they're right up front.
-                Shape dot_axis_sizes(reduction_axes_count);
-                std::copy(arg1_shape.begin(),
-                          arg1_shape.begin() + reduction_axes_count,
-                          dot_axis_sizes.begin());
-
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
+                // The dotted axes are the last reduction_axes_count axes of arg0 and the first
+                // reduction_axes_count axes of arg1, so the inputs are row-major matrices of
+                // shape [m, k] and [k, n] and the output is [m, n].
                 size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                Shape arg0_projected_shape(arg0_projected_rank);
-                std::copy(arg0_shape.begin(),
-                          arg0_shape.begin() + arg0_projected_rank,
-                          arg0_projected_shape.begin());
-
-                Shape arg1_projected_shape(arg1_projected_rank);
-                std::copy(arg1_shape.begin() + reduction_axes_count,
-                          arg1_shape.end(),
-                          arg1_projected_shape.begin());
-
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
-
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
+                size_t m_size = 1;
+                for (size_t i = 0; i < arg0_projected_rank; ++i)
                 {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
-                    {
-                        // The output coordinate is just the concatenation of the projected
-                        // coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
-
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
-
-                        // Zero out to start the sum.
-                        ACCUMULATION sum = 0;
-
-                        size_t out_index = output_transform.index(out_coord);
-
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
-                        {
-                            // In order to find the points to multiply together, we need to inject
-                            // our current positions along the dotted axes back into the projected
-                            // arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
-
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
-
-                            // Multiply and add to the sum.
-                            if (is_quantized)
-                            {
-                                sum += (static_cast<ACCUMULATION>(
-                                            arg0[arg0_transform.index(arg0_coord)]) -
-                                        static_cast<ACCUMULATION>(*input0_zero_point)) *
-                                       (static_cast<ACCUMULATION>(
-                                            arg1[arg1_transform.index(arg1_coord)]) -
-                                        static_cast<ACCUMULATION>(*input1_zero_point));
-                            }
-                            else
-                            {
-                                sum += static_cast<ACCUMULATION>(
-                                           arg0[arg0_transform.index(arg0_coord)]) *
-                                       static_cast<ACCUMULATION>(
-                                           arg1[arg1_transform.index(arg1_coord)]);
-                            }
-                        }
+                    m_size *= arg0_shape[i];
+                }
+                size_t k_size = 1;
+                for (size_t i = 0; i < reduction_axes_count; ++i)
+                {
+                    k_size *= arg1_shape[i];
+                }
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+                size_t n_size = shape_size(out_shape) / m_size;
 
-                        if (is_quantized)
-                        {
-                            float scale = *input0_scale * *input1_scale / *output_scale;
-                            // Write the sum back.
-                            out[out_index] =
-                                static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
-                                *output_zero_point;
-                        }
-                        else
-                        {
-                            out[out_index] = sum;
-                        }
-                    }
+                if (is_quantized)
+                {
+                    auto old_mode = std::fegetround();
+                    std::fesetround(FE_TONEAREST);
+                    float scale = *input0_scale * *input1_scale / *output_scale;
+                    dot_row_major<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(
+                        arg0,
+                        arg1,
+                        out,
+                        m_size,
+                        k_size,
+                        n_size,
+                        static_cast<ACCUMULATION>(*input0_zero_point),
+                        static_cast<ACCUMULATION>(*input1_zero_point),
+                        &scale,
+                        output_zero_point);
                     std::fesetround(old_mode);
                 }
+                else
+                {
+                    dot_row_major<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(
+                        arg0, arg1, out, m_size, k_size, n_size);
+                }
             }
         }
     }
@@ -0,0 +1,41 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief out = 0.5 * x * (1 + erf(x / sqrt(2))) in a single sweep
+            template <typename T>
+            void gelu(const T* arg, T* out, size_t count)
+            {
+                const double inv_sqrt_2 = 1.0 / std::sqrt(2.0);
+                for (size_t i = 0; i < count; i++)
+                {
+                    double x = static_cast<double>(arg[i]);
+                    out[i] = static_cast<T>(0.5 * x * (1.0 + std::erf(x * inv_sqrt_2)));
+                }
+            }
+        }
+    }
+}
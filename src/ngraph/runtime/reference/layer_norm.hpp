@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Layer normalization over the axes from begin_norm_axis on
+            ///
+            /// Those axes are contiguous, so each row is normalized in place while it is in cache:
+            /// one sweep for the mean, one for the variance and one to write the output.
+            ///
+            /// \param scale Per element scale of a row, or nullptr
+            /// \param bias Per element bias of a row, or nullptr
+            /// \param mean Receives the mean of each row, or nullptr
+            /// \param variance Receives the variance of each row, or nullptr
+            template <typename T>
+            void layer_norm(const T* arg,
+                            const T* scale,
+                            const T* bias,
+                            T* out,
+                            T* mean,
+                            T* variance,
+                            const Shape& shape,
+                            size_t begin_norm_axis,
+                            double epsilon)
+            {
+                size_t row_count = 1;
+                size_t row_size = 1;
+                for (size_t axis = 0; axis < shape.size(); ++axis)
+                {
+                    (axis < begin_norm_axis ? row_count : row_size) *= shape[axis];
+                }
+
+                for (size_t row = 0; row < row_count; ++row)
+                {
+                    const T* in = arg + row * row_size;
+                    T* result = out + row * row_size;
+
+                    double sum = 0;
+                    for (size_t i = 0; i < row_size; ++i)
+                    {
+                        sum += static_cast<double>(in[i]);
+                    }
+                    double row_mean = sum / row_size;
+
+                    double square_sum = 0;
+                    for (size_t i = 0; i < row_size; ++i)
+                    {
+                        double d = static_cast<double>(in[i]) - row_mean;
+                        square_sum += d * d;
+                    }
+                    double row_variance = square_sum / row_size;
+
+                    double inv_stddev = 1.0 / std::sqrt(row_variance + epsilon);
+                    for (size_t i = 0; i < row_size; ++i)
+                    {
+                        double y = (static_cast<double>(in[i]) - row_mean) * inv_stddev;
+                        if (scale != nullptr)
+                        {
+                            y = y * static_cast<double>(scale[i]) + static_cast<double>(bias[i]);
+                        }
+                        result[i] = static_cast<T>(y);
+                    }
+
+                    if (mean != nullptr)
+                    {
+                        mean[row] = static_cast<T>(row_mean);
+                    }
+                    if (variance != nullptr)
+                    {
+                        variance[row] = static_cast<T>(row_variance);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -17,10 +17,8 @@
 #pragma once
 
 #include <cmath>
-#include <map>
-#include <vector>
+#include <cstdint>
 
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
@@ -39,52 +37,17 @@ namespace ngraph
                       const Shape& out_shape,
                       const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                sum(arg, out, in_shape, out_shape, reduction_axes);
 
-                for (const Coordinate& output_coord : output_transform)
+                size_t out_size = shape_size(out_shape);
+                if (out_size == 0)
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
+                    return;
                 }
-
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
-                }
-
-                for (const Coordinate& output_coord : output_transform)
+                auto count = static_cast<int64_t>(shape_size(in_shape) / out_size);
+                for (size_t i = 0; i < out_size; ++i)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = static_cast<T>(out[i] / count);
                 }
             }
         }
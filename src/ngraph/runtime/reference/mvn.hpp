@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Mean variance normalization over reduction_axes
+            ///
+            /// out = (x - mean) / (sqrt(variance) + eps), or x - mean without normalize_variance.
+            /// The statistics of every group are accumulated side by side in sweeps over arg, so
+            /// no intermediate tensor of the input's size is created.
+            template <typename T>
+            void mvn(const T* arg,
+                     T* out,
+                     const Shape& shape,
+                     const AxisSet& reduction_axes,
+                     bool normalize_variance,
+                     double eps)
+            {
+                size_t group_count = shape_size(reduce(shape, reduction_axes));
+                if (group_count == 0)
+                {
+                    return;
+                }
+                double group_size = static_cast<double>(shape_size(shape) / group_count);
+
+                StridedWalk walk(shape,
+                                 StridedWalk::row_major_strides(shape),
+                                 StridedWalk::reduced_strides(shape, reduction_axes));
+                const size_t n = walk.get_run_length();
+                const std::ptrdiff_t s_step = walk.get_src_run_stride();
+                const std::ptrdiff_t d_step = walk.get_dst_run_stride();
+
+                std::vector<double> mean(group_count, 0);
+                walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                    for (size_t i = 0; i < n; ++i, s += s_step, d += d_step)
+                    {
+                        mean[d] += static_cast<double>(arg[s]);
+                    }
+                });
+                for (double& m : mean)
+                {
+                    m /= group_size;
+                }
+
+                std::vector<double> inv_scale(group_count, 1);
+                if (normalize_variance)
+                {
+                    std::vector<double> square_sum(group_count, 0);
+                    walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                        for (size_t i = 0; i < n; ++i, s += s_step, d += d_step)
+                        {
+                            double diff = static_cast<double>(arg[s]) - mean[d];
+                            square_sum[d] += diff * diff;
+                        }
+                    });
+                    for (size_t g = 0; g < group_count; ++g)
+                    {
+                        inv_scale[g] = 1.0 / (std::sqrt(square_sum[g] / group_size) + eps);
+                    }
+                }
+
+                walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                    for (size_t i = 0; i < n; ++i, s += s_step, d += d_step)
+                    {
+                        out[s] =
+                            static_cast<T>((static_cast<double>(arg[s]) - mean[d]) * inv_scale[d]);
+                    }
+                });
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief out = x / sqrt(sum(x * x) + eps) over reduction_axes, with max instead of +
+            ///        for EpsMode::MAX. Takes two sweeps over arg and no intermediate tensors.
+            template <typename T>
+            void normalize_l2(const T* arg,
+                              T* out,
+                              const Shape& shape,
+                              const AxisSet& reduction_axes,
+                              float eps,
+                              op::EpsMode eps_mode)
+            {
+                size_t group_count = shape_size(reduce(shape, reduction_axes));
+                StridedWalk walk(shape,
+                                 StridedWalk::row_major_strides(shape),
+                                 StridedWalk::reduced_strides(shape, reduction_axes));
+                const size_t n = walk.get_run_length();
+                const std::ptrdiff_t s_step = walk.get_src_run_stride();
+                const std::ptrdiff_t d_step = walk.get_dst_run_stride();
+
+                std::vector<double> inv_norm(group_count, 0);
+                walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                    for (size_t i = 0; i < n; ++i, s += s_step, d += d_step)
+                    {
+                        double x = static_cast<double>(arg[s]);
+                        inv_norm[d] += x * x;
+                    }
+                });
+                for (double& v : inv_norm)
+                {
+                    v = 1.0 / std::sqrt(eps_mode == op::EpsMode::MAX ? std::max(v, double(eps))
+                                                                     : v + eps);
+                }
+
+                walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                    for (size_t i = 0; i < n; ++i, s += s_step, d += d_step)
+                    {
+                        out[s] = static_cast<T>(static_cast<double>(arg[s]) * inv_norm[d]);
+                    }
+                });
+            }
+        }
+    }
+}
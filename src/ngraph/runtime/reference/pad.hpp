@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/pad.hpp" // for op::PadMode
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -39,6 +41,39 @@ namespace ngraph
                      const CoordinateDiff& padding_above,
                      op::PadMode pad_mode)
             {
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    // Fill with the pad value, then copy the part of the argument that survives
+                    // any negative (cropping) padding into its window of the output.
+                    NGRAPH_CHECK(out_shape.size() == arg0_shape.size() &&
+                                 padding_below.size() == arg0_shape.size() &&
+                                 padding_above.size() == arg0_shape.size());
+                    std::fill(out, out + shape_size(out_shape), *arg1);
+
+                    std::vector<std::ptrdiff_t> arg0_strides =
+                        StridedWalk::row_major_strides(arg0_shape);
+                    std::vector<std::ptrdiff_t> out_strides =
+                        StridedWalk::row_major_strides(out_shape);
+                    Shape copy_shape(arg0_shape.size());
+                    std::ptrdiff_t arg0_offset = 0;
+                    std::ptrdiff_t out_offset = 0;
+                    for (size_t i = 0; i < arg0_shape.size(); i++)
+                    {
+                        std::ptrdiff_t below = padding_below[i];
+                        std::ptrdiff_t above = padding_above[i];
+                        std::ptrdiff_t length = static_cast<std::ptrdiff_t>(arg0_shape[i]) +
+                                                std::min<std::ptrdiff_t>(below, 0) +
+                                                std::min<std::ptrdiff_t>(above, 0);
+                        copy_shape[i] = static_cast<size_t>(std::max<std::ptrdiff_t>(length, 0));
+                        arg0_offset += std::max<std::ptrdiff_t>(-below, 0) * arg0_strides[i];
+                        out_offset += std::max<std::ptrdiff_t>(below, 0) * out_strides[i];
+                    }
+                    StridedWalk walk(
+                        copy_shape, arg0_strides, out_strides, arg0_offset, out_offset);
+                    walk.copy(arg0, out);
+                    return;
+                }
+
                 Coordinate input_start(arg0_shape.size(), 0); // start at (0,0,...,0)
                 Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
                                                   // the post-padding shape
@@ -74,10 +109,7 @@ namespace ngraph
                     switch (pad_mode)
                     {
                     case op::PadMode::CONSTANT:
-                        // If the coordinate is out of bounds, substitute *arg1.
-                        v = input_transform.has_source_coordinate(in_coord)
-                                ? arg0[input_transform.index(in_coord)]
-                                : *arg1;
+                        // Handled by the strided copy above.
                         break;
                     case op::PadMode::EDGE:
                     {
@@ -18,7 +18,7 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,26 +31,12 @@ namespace ngraph
             void product(const T* arg,
                          T* out,
                          const Shape& in_shape,
-                         const Shape& out_shape,
+                         const Shape& /* out_shape */,
                          const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] = out[output_index] * arg[input_transform.index(input_coord)];
-                }
+                reduction_fold(arg, out, in_shape, reduction_axes, T(1), [](T a, T b) {
+                    return static_cast<T>(a * b);
+                });
             }
         }
     }
@@ -0,0 +1,193 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Number of independent accumulators a contiguous run is split across.
+            constexpr size_t reduction_lanes = 8;
+
+            /// \brief Folds every element of arg into the output element it reduces to, so that
+            ///        out = combine(...combine(combine(identity, x0), x1)..., xn).
+            ///
+            /// Unit axes are dropped and neighbouring axes that are both reduced or both kept are
+            /// merged, which leaves one of three layouts:
+            /// - inner contiguous: the innermost axis is reduced, so each output folds contiguous
+            ///   runs of arg. A run is folded across reduction_lanes independent accumulators
+            ///   that are combined at the end.
+            /// - outer: the innermost axis is kept, so each contiguous row of arg is folded
+            ///   elementwise into a contiguous row of out.
+            /// - strided: reduced and kept axes interleave further out. The innermost axis is
+            ///   still one of the two cases above and the outer axes are walked odometer style.
+            /// No Coordinate is built per element and the innermost loops are contiguous, so the
+            /// compiler can vectorize them. combine must be associative and commutative.
+            template <typename T, typename COMBINE>
+            void reduction_fold(const T* arg,
+                                T* out,
+                                const Shape& in_shape,
+                                const AxisSet& reduction_axes,
+                                T identity,
+                                COMBINE combine)
+            {
+                std::fill(out, out + shape_size(reduce(in_shape, reduction_axes)), identity);
+
+                StridedWalk walk(in_shape,
+                                 StridedWalk::row_major_strides(in_shape),
+                                 StridedWalk::reduced_strides(in_shape, reduction_axes));
+                const size_t n = walk.get_run_length();
+                if (walk.get_dst_run_stride() == 0)
+                {
+                    walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                        const T* in = arg + s;
+                        T lanes[reduction_lanes];
+                        std::fill(lanes, lanes + reduction_lanes, identity);
+                        size_t i = 0;
+                        for (; i + reduction_lanes <= n; i += reduction_lanes)
+                        {
+                            for (size_t j = 0; j < reduction_lanes; ++j)
+                            {
+                                lanes[j] = combine(lanes[j], in[i + j]);
+                            }
+                        }
+                        T result = out[d];
+                        for (size_t j = 0; j < reduction_lanes; ++j)
+                        {
+                            result = combine(result, lanes[j]);
+                        }
+                        for (; i < n; ++i)
+                        {
+                            result = combine(result, in[i]);
+                        }
+                        out[d] = result;
+                    });
+                }
+                else
+                {
+                    walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                        const T* in = arg + s;
+                        T* acc = out + d;
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            acc[i] = combine(acc[i], in[i]);
+                        }
+                    });
+                }
+            }
+
+            /// \brief One step of Kahan summation. The compensation is only kept while the sum
+            ///        is finite, so an infinity stays an infinity instead of becoming NaN.
+            template <typename T>
+            inline void compensated_add(T& sum, T& compensation, T x)
+            {
+                T y = x - compensation;
+                T t = sum + y;
+                compensation = std::abs(t) <= std::numeric_limits<T>::max() ? (t - sum) - y : T(0);
+                sum = t;
+            }
+
+            /// \brief Sums arg over reduction_axes with the same layouts as reduction_fold.
+            ///
+            /// Floating point sums are compensated. Each output keeps a Kahan compensation
+            /// term, and inner contiguous runs are summed in reduction_lanes compensated lanes
+            /// before they are added to the output, so the accuracy matches a sequential Kahan
+            /// sum while the loops stay vectorizable.
+            template <typename T>
+            typename std::enable_if<!std::is_floating_point<T>::value>::type
+                reduction_sum(const T* arg,
+                              T* out,
+                              const Shape& in_shape,
+                              const AxisSet& reduction_axes)
+            {
+                reduction_fold(arg, out, in_shape, reduction_axes, T(0), [](T a, T b) {
+                    return static_cast<T>(a + b);
+                });
+            }
+
+            template <typename T>
+            typename std::enable_if<std::is_floating_point<T>::value>::type
+                reduction_sum(const T* arg,
+                              T* out,
+                              const Shape& in_shape,
+                              const AxisSet& reduction_axes)
+            {
+                const size_t out_size = shape_size(reduce(in_shape, reduction_axes));
+                std::fill(out, out + out_size, T(0));
+                std::vector<T> cs(out_size, T(0));
+
+                StridedWalk walk(in_shape,
+                                 StridedWalk::row_major_strides(in_shape),
+                                 StridedWalk::reduced_strides(in_shape, reduction_axes));
+                const size_t n = walk.get_run_length();
+                if (walk.get_dst_run_stride() == 0)
+                {
+                    walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                        const T* in = arg + s;
+                        T lane_sum[reduction_lanes] = {};
+                        T lane_cs[reduction_lanes] = {};
+                        size_t i = 0;
+                        for (; i + reduction_lanes <= n; i += reduction_lanes)
+                        {
+                            for (size_t j = 0; j < reduction_lanes; ++j)
+                            {
+                                compensated_add(lane_sum[j], lane_cs[j], in[i + j]);
+                            }
+                        }
+                        T& z = out[d];
+                        T& c = cs[d];
+                        for (size_t j = 0; j < reduction_lanes; ++j)
+                        {
+                            compensated_add(z, c, lane_sum[j]);
+                            compensated_add(z, c, -lane_cs[j]);
+                        }
+                        for (; i < n; ++i)
+                        {
+                            compensated_add(z, c, in[i]);
+                        }
+                    });
+                }
+                else
+                {
+                    walk.for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                        const T* in = arg + s;
+                        T* z = out + d;
+                        T* c = cs.data() + d;
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            compensated_add(z[i], c[i], in[i]);
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
@@ -18,7 +18,9 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -34,24 +36,21 @@ namespace ngraph
                          const AxisSet& reversed_axes)
             {
                 // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with
-                // other kernels.
-                CoordinateTransform arg_transform(arg_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (Coordinate out_coord : output_transform)
+                // other kernels. A reversed axis is walked from its last element backwards.
+                std::vector<std::ptrdiff_t> arg_strides = StridedWalk::row_major_strides(arg_shape);
+                std::ptrdiff_t arg_offset = 0;
+                for (size_t i = 0; i < arg_shape.size(); i++)
                 {
-                    Coordinate arg_coord = out_coord;
-
-                    for (size_t i = 0; i < arg_coord.size(); i++)
+                    if (reversed_axes.count(i) != 0 && arg_shape[i] > 0)
                     {
-                        if (reversed_axes.count(i) != 0)
-                        {
-                            arg_coord[i] = arg_shape[i] - arg_coord[i] - 1;
-                        }
+                        arg_offset +=
+                            static_cast<std::ptrdiff_t>(arg_shape[i] - 1) * arg_strides[i];
+                        arg_strides[i] = -arg_strides[i];
                     }
-
-                    out[output_transform.index(out_coord)] = arg[arg_transform.index(arg_coord)];
                 }
+                StridedWalk walk(
+                    out_shape, arg_strides, StridedWalk::row_major_strides(out_shape), arg_offset);
+                walk.copy(arg, out);
             }
         }
     }
@@ -19,7 +19,10 @@
 #include <cmath>
 
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strided_walk.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -36,22 +39,29 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(lower_bounds.size() == arg_shape.size() &&
+                             upper_bounds.size() == arg_shape.size() &&
+                             strides.size() == arg_shape.size());
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                std::vector<std::ptrdiff_t> arg_strides = StridedWalk::row_major_strides(arg_shape);
+                Shape slice_shape(arg_shape.size());
+                std::ptrdiff_t arg_offset = 0;
+                for (size_t i = 0; i < arg_shape.size(); i++)
                 {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
+                    NGRAPH_CHECK(strides[i] > 0 && lower_bounds[i] <= upper_bounds[i] &&
+                                 upper_bounds[i] <= arg_shape[i]);
+                    slice_shape[i] =
+                        (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i];
+                    arg_offset += static_cast<std::ptrdiff_t>(lower_bounds[i]) * arg_strides[i];
+                    arg_strides[i] *= static_cast<std::ptrdiff_t>(strides[i]);
                 }
+                NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
+
+                StridedWalk walk(slice_shape,
+                                 arg_strides,
+                                 StridedWalk::row_major_strides(slice_shape),
+                                 arg_offset);
+                walk.copy(arg, out);
             }
         }
     }
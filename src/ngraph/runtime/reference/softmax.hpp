@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
+
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
@@ -56,6 +58,33 @@ namespace ngraph
 
                 delete[] temp_ptr;
             }
+
+            /// \brief Runs a half precision softmax in f32, so the exponentials are summed in f32
+            ///        and each output is rounded once.
+            template <typename T>
+            void softmax_in_f32(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            {
+                size_t count = shape_size(shape);
+                std::vector<float> arg_f32(count);
+                std::vector<float> out_f32(count);
+                T::to_float(arg, arg_f32.data(), count);
+                softmax(arg_f32.data(), out_f32.data(), shape, axes);
+                T::from_float(out_f32.data(), out, count);
+            }
+
+            template <>
+            inline void
+                softmax(const float16* arg, float16* out, const Shape& shape, const AxisSet& axes)
+            {
+                softmax_in_f32(arg, out, shape, axes);
+            }
+
+            template <>
+            inline void
+                softmax(const bfloat16* arg, bfloat16* out, const Shape& shape, const AxisSet& axes)
+            {
+                softmax_in_f32(arg, out, shape, axes);
+            }
         }
     }
 }
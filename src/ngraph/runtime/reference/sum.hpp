@@ -17,8 +17,9 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -56,39 +57,48 @@ namespace ngraph
             void sum(const T* arg,
                      T* out,
                      const Shape& in_shape,
-                     const Shape& out_shape,
+                     const Shape& /* out_shape */,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
+                reduction_sum(arg, out, in_shape, reduction_axes);
+            }
 
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
+            /// \brief Sums half precision values in f32 and rounds each result once.
+            ///
+            /// The compensation term of the Kahan sum is smaller than one ulp of the running
+            /// total, so it would mostly round away if it were kept in f16 or bf16.
+            template <typename T>
+            void sum_in_f32(const T* arg,
+                            T* out,
+                            const Shape& in_shape,
+                            const Shape& out_shape,
+                            const AxisSet& reduction_axes)
+            {
+                std::vector<float> arg_f32(shape_size(in_shape));
+                std::vector<float> out_f32(shape_size(out_shape));
+                T::to_float(arg, arg_f32.data(), arg_f32.size());
+                sum(arg_f32.data(), out_f32.data(), in_shape, out_shape, reduction_axes);
+                T::from_float(out_f32.data(), out, out_f32.size());
+            }
 
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
+            template <>
+            inline void sum(const float16* arg,
+                            float16* out,
+                            const Shape& in_shape,
+                            const Shape& out_shape,
+                            const AxisSet& reduction_axes)
+            {
+                sum_in_f32(arg, out, in_shape, out_shape, reduction_axes);
+            }
 
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
-                }
+            template <>
+            inline void sum(const bfloat16* arg,
+                            bfloat16* out,
+                            const Shape& in_shape,
+                            const Shape& out_shape,
+                            const AxisSet& reduction_axes)
+            {
+                sum_in_f32(arg, out, in_shape, out_shape, reduction_axes);
             }
         }
     }
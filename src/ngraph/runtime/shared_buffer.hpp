@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        template <typename T>
+        class SharedBuffer;
+    }
+}
+
+/// \brief An AlignedBuffer over memory that belongs to another object, such as a MappedFile.
+///
+/// The owner is kept alive for as long as the buffer is and nothing is freed when the buffer
+/// goes away. AlignedBuffer has no virtual destructor, so hold a SharedBuffer through a
+/// shared_ptr made from the derived type (e.g. std::make_shared<SharedBuffer<T>>).
+template <typename T>
+class ngraph::runtime::SharedBuffer : public ngraph::runtime::AlignedBuffer
+{
+public:
+    /// \param data Start of the buffer, inside the memory owned by shared_object
+    /// \param size Size of the buffer in bytes
+    /// \param shared_object The owner of the memory
+    SharedBuffer(char* data, size_t size, const std::shared_ptr<T>& shared_object)
+        : m_shared_object(shared_object)
+    {
+        m_aligned_buffer = data;
+        m_byte_size = size;
+    }
+
+private:
+    std::shared_ptr<T> m_shared_object;
+};
@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/check.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    thread_local const runtime::ThreadPool* s_current_pool = nullptr;
+    thread_local size_t s_current_worker = 0;
+}
+
+runtime::ThreadPool::ThreadPool(size_t thread_count)
+{
+    NGRAPH_CHECK(thread_count > 0, "ThreadPool needs at least one thread");
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        m_queues.emplace_back(new WorkQueue());
+    }
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        m_workers.emplace_back(&ThreadPool::worker_loop, this, i);
+    }
+}
+
+runtime::ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_idle_mutex);
+        m_stop = true;
+    }
+    m_idle_cv.notify_all();
+    for (thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+int runtime::ThreadPool::get_worker_index() const
+{
+    return s_current_pool == this ? static_cast<int>(s_current_worker) : -1;
+}
+
+void runtime::ThreadPool::submit(Task task)
+{
+    int worker = get_worker_index();
+    size_t index = worker >= 0 ? static_cast<size_t>(worker)
+                               : m_next_queue.fetch_add(1) % m_queues.size();
+    {
+        lock_guard<mutex> lock(m_queues[index]->m_mutex);
+        m_queues[index]->m_tasks.push_back(move(task));
+    }
+    {
+        lock_guard<mutex> lock(m_idle_mutex);
+        m_pending++;
+    }
+    m_idle_cv.notify_one();
+}
+
+bool runtime::ThreadPool::pop_task(size_t index, Task& task)
+{
+    {
+        WorkQueue& own = *m_queues[index];
+        lock_guard<mutex> lock(own.m_mutex);
+        if (!own.m_tasks.empty())
+        {
+            task = move(own.m_tasks.back());
+            own.m_tasks.pop_back();
+            return true;
+        }
+    }
+    for (size_t i = 1; i < m_queues.size(); ++i)
+    {
+        WorkQueue& victim = *m_queues[(index + i) % m_queues.size()];
+        lock_guard<mutex> lock(victim.m_mutex);
+        if (!victim.m_tasks.empty())
+        {
+            task = move(victim.m_tasks.front());
+            victim.m_tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::ThreadPool::worker_loop(size_t index)
+{
+    s_current_pool = this;
+    s_current_worker = index;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_idle_mutex);
+            m_idle_cv.wait(lock, [this] { return m_stop || m_pending > 0; });
+            if (m_pending == 0)
+            {
+                // Stopping and no work left
+                return;
+            }
+            m_pending--;
+        }
+        // A task is reserved for this worker, it may still be in flight to a queue
+        Task task;
+        while (!pop_task(index, task))
+        {
+            this_thread::yield();
+        }
+        task();
+    }
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ThreadPool;
+    }
+}
+
+/// \brief A fixed size pool of worker threads with one task queue per worker.
+///
+/// A task submitted from a worker thread is pushed on that worker's own queue and the worker
+/// runs its own queue newest first, which keeps a chain of dependent tasks on one core. An idle
+/// worker steals the oldest task from the other queues.
+class NGRAPH_API ngraph::runtime::ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    /// \brief Create the pool
+    /// \param thread_count Number of worker threads, must be greater than 0
+    explicit ThreadPool(size_t thread_count);
+    ~ThreadPool();
+
+    size_t get_thread_count() const { return m_workers.size(); }
+    /// \brief Queue a task to run on one of the worker threads
+    void submit(Task task);
+
+    /// \returns The index of the calling worker thread, or -1 if the caller is not a worker
+    ///     of this pool
+    int get_worker_index() const;
+
+private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    struct WorkQueue
+    {
+        std::mutex m_mutex;
+        std::deque<Task> m_tasks;
+    };
+
+    void worker_loop(size_t index);
+    bool pop_task(size_t index, Task& task);
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::atomic<size_t> m_next_queue{0};
+    std::mutex m_idle_mutex;
+    // Tasks queued but not yet claimed by a worker, guarded by m_idle_mutex
+    size_t m_pending{0};
+    std::condition_variable m_idle_cv;
+    bool m_stop{false};
+};
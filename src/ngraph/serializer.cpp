@@ -14,8 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <limits>
 #include <queue>
 #include <stack>
 
@@ -28,6 +30,8 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/runtime/mapped_file.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -44,6 +48,9 @@ static PartialShape read_partial_shape(json j);
 
 static bool s_serialize_output_shapes_enabled = getenv_bool("NGRAPH_SERIALIZER_OUTPUT_SHAPES");
 
+// Alignment of constant data records in cpio archives, matching op::Constant's own buffers
+static const size_t s_constant_data_alignment = 64;
+
 void ngraph::set_serialize_output_shapes(bool enable)
 {
     s_serialize_output_shapes_enabled = enable;
@@ -173,6 +180,13 @@ public:
         m_binary_constant_data = binary_constant_data;
     }
 
+    /// \brief Constants whose data was left out of the json because binary constant data is
+    ///        enabled, in serialization order
+    const vector<const op::Constant*>& get_binary_constants() const
+    {
+        return m_binary_constants;
+    }
+
     json serialize_function(const Function& function);
     json serialize_output(const Output<Node>& output);
     json serialize_parameter_vector(const ParameterVector& parameters);
@@ -188,6 +202,7 @@ protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
     bool m_binary_constant_data{false};
+    vector<const op::Constant*> m_binary_constants;
     json m_json_nodes;
 };
 
@@ -303,7 +318,7 @@ protected:
 };
 
 static string
-    serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
+    serialize(shared_ptr<ngraph::Function> func, size_t indent, JSONSerializer& serializer);
 
 static json write_dimension(Dimension d)
 {
@@ -449,34 +464,40 @@ void ngraph::serialize(const string& path, shared_ptr<ngraph::Function> func, si
 
 void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
 {
-    out << ::serialize(func, indent, false);
+    JSONSerializer serializer;
+    out << ::serialize(func, indent, serializer);
+}
+
+void ngraph::serialize_to_cpio(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_to_cpio(out, func, indent);
 }
 
-#if defined ENABLE_CPIO_FILE
-static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+void ngraph::serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
 {
-    string j = ::serialize(func, indent, true);
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+    string j = ::serialize(func, indent, serializer);
+
     cpio::Writer writer(out);
     writer.write(func->get_name(), j.c_str(), static_cast<uint32_t>(j.size()));
-
-    traverse_nodes(const_cast<Function*>(func.get()),
-                   [&](shared_ptr<Node> node) {
-                       if (auto c = node->as_type<op::Constant>())
-                       {
-                           uint32_t size =
-                               static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
-                                                     c->get_output_element_type(0).size());
-                           writer.write(c->get_name(), c->get_data_ptr(), size);
-                       }
-                   },
-                   true);
+    for (const op::Constant* c : serializer.get_binary_constants())
+    {
+        size_t size = (shape_size(c->get_shape()) * c->get_element_type().bitwidth() + 7) / 8;
+        NGRAPH_CHECK(size <= numeric_limits<uint32_t>::max(),
+                     "Constant '",
+                     c->get_name(),
+                     "' is too large for a cpio record");
+        writer.write(c->get_name(),
+                     c->get_data_ptr(),
+                     static_cast<uint32_t>(size),
+                     s_constant_data_alignment);
+    }
 }
-#endif
 
-static string serialize(shared_ptr<Function> func, size_t indent, bool binary_constant_data)
+static string serialize(shared_ptr<Function> func, size_t indent, JSONSerializer& serializer)
 {
-    JSONSerializer serializer;
-    serializer.set_binary_constant_data(binary_constant_data);
     serializer.set_indent(indent);
     serializer.set_serialize_output_shapes(s_serialize_output_shapes_enabled);
 
@@ -497,7 +518,97 @@ static string serialize(shared_ptr<Function> func, size_t indent, bool binary_co
 
 std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t indent)
 {
-    return ::serialize(func, indent, false);
+    JSONSerializer serializer;
+    return ::serialize(func, indent, serializer);
+}
+
+// Replaces every string in j that is a key of names with the mapped value
+static void rename_strings(json& j, const unordered_map<string, string>& names)
+{
+    if (j.is_string())
+    {
+        auto it = names.find(j.get<string>());
+        if (it != names.end())
+        {
+            j = it->second;
+        }
+    }
+    else if (j.is_array() || j.is_object())
+    {
+        for (json& element : j)
+        {
+            rename_strings(element, names);
+        }
+    }
+}
+
+string ngraph::serialize_structure(shared_ptr<Function> func,
+                                   vector<shared_ptr<Node>>& constants)
+{
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+    json j = serializer.serialize_function(*func);
+
+    // Names come from global counters and differ from one process to the next
+    unordered_map<string, string> names;
+    names[func->get_name()] = "function";
+    size_t index = 0;
+    for (shared_ptr<Node> node : func->get_ordered_ops())
+    {
+        string name = "n" + to_string(index++);
+        names[node->get_name()] = name;
+        for (auto& output : node->outputs())
+        {
+            names[output.get_tensor().get_name()] = name + "_" + to_string(output.get_index());
+        }
+    }
+    rename_strings(j, names);
+
+    constants.clear();
+    for (const op::Constant* c : serializer.get_binary_constants())
+    {
+        constants.push_back(const_cast<op::Constant*>(c)->shared_from_this());
+    }
+    return j.dump();
+}
+
+// Reads a cpio archive written by serialize_to_cpio. The first record is the json model; the
+// data of every Constant is obtained from its record through get_constant_data.
+static shared_ptr<Function> deserialize_cpio(
+    cpio::Reader& reader,
+    function<shared_ptr<runtime::AlignedBuffer>(const cpio::FileInfo&)> get_constant_data)
+{
+    shared_ptr<Function> rc;
+    const vector<cpio::FileInfo>& file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        vector<char> model = reader.read(file_info[0]);
+        json js = json::parse(model.begin(), model.end());
+
+        unordered_map<string, const cpio::FileInfo*> records;
+        for (const cpio::FileInfo& info : file_info)
+        {
+            records[info.get_name()] = &info;
+        }
+
+        JSONDeserializer deserializer;
+        deserializer.set_const_data_callback(
+            [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                shared_ptr<Node> const_node;
+                auto it = records.find(const_name);
+                if (it != records.end())
+                {
+                    const_node =
+                        make_shared<op::Constant>(et, shape, get_constant_data(*it->second));
+                }
+                return const_node;
+            });
+        for (json func : js)
+        {
+            rc = deserializer.deserialize_function(func);
+        }
+    }
+    return rc;
 }
 
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
@@ -506,38 +617,13 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
     if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
-        vector<cpio::FileInfo> file_info = reader.get_file_info();
-        if (file_info.size() > 0)
-        {
-            // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
-            JSONDeserializer deserializer;
-            deserializer.set_const_data_callback(
-                [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                    shared_ptr<Node> const_node;
-                    for (const cpio::FileInfo& info : file_info)
-                    {
-                        if (info.get_name() == const_name)
-                        {
-                            void* const_data = ngraph_malloc(info.get_size());
-                            reader.read(const_name, const_data, info.get_size());
-                            const_node = make_shared<op::Constant>(et, shape, const_data);
-                            ngraph_free(const_data);
-                            break;
-                        }
-                    }
-                    return const_node;
-                });
-            for (json func : js)
-            {
-                rc = deserializer.deserialize_function(func);
-            }
-        }
+        rc = deserialize_cpio(reader, [&](const cpio::FileInfo& info) {
+            // Read each record straight into the constant's buffer
+            auto buffer =
+                make_shared<runtime::AlignedBuffer>(info.get_size(), s_constant_data_alignment);
+            reader.read(info, buffer->get_ptr());
+            return buffer;
+        });
     }
     else
     {
@@ -555,8 +641,39 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     if (file_util::exists(s))
     {
         // s is a file and not a json string
-        ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (cpio::is_cpio(s))
+        {
+            // Map the archive and let the constants use their records in place. Records that
+            // are not suitably aligned (archives from older writers) are copied instead.
+            auto mapping = make_shared<runtime::MappedFile>(s);
+            cpio::Reader reader(s);
+            rc = deserialize_cpio(reader, [&](const cpio::FileInfo& info) {
+                NGRAPH_CHECK(info.get_offset() + info.get_size() <= mapping->size(),
+                             "cpio record '",
+                             info.get_name(),
+                             "' extends past the end of ",
+                             s);
+                char* data = mapping->get_ptr() + info.get_offset();
+                shared_ptr<runtime::AlignedBuffer> buffer;
+                if (reinterpret_cast<size_t>(data) % s_constant_data_alignment == 0)
+                {
+                    buffer = make_shared<runtime::SharedBuffer<runtime::MappedFile>>(
+                        data, info.get_size(), mapping);
+                }
+                else
+                {
+                    buffer = make_shared<runtime::AlignedBuffer>(info.get_size(),
+                                                                 s_constant_data_alignment);
+                    memcpy(buffer->get_ptr(), data, info.get_size());
+                }
+                return buffer;
+            });
+        }
+        else
+        {
+            ifstream in(s, ios_base::binary | ios_base::in);
+            rc = deserialize(in);
+        }
     }
     else
     {
@@ -1144,8 +1261,18 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::Constant>(element_type, shape, value);
+            if (has_key(node_js, "value"))
+            {
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::Constant>(element_type, shape, value);
+            }
+            else
+            {
+                // The data was written outside the json, e.g. by serialize_to_cpio
+                NGRAPH_CHECK(m_const_data_callback, "No data source for constant ", node_name);
+                node = m_const_data_callback(node_name, element_type, shape);
+                NGRAPH_CHECK(node, "No data found for constant ", node_name);
+            }
             break;
         }
         case OP_TYPEID::Convert:
@@ -2912,7 +3039,12 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        if (m_binary_constant_data)
+        {
+            m_binary_constants.push_back(tmp);
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_shape()) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -51,13 +51,51 @@ namespace ngraph
     NGRAPH_API
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a cpio archive with binary constant data
+    ///
+    /// The first record of the archive is the json graph, which leaves out the values of
+    /// Constants. The data of each Constant follows as a raw record, aligned to 64 bytes from
+    /// the start of the archive. Deserializing such a file by path maps it into memory and the
+    /// Constants use their records in place, with no parsing or copying.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    /// \param indent Formatting of the json graph, as for serialize()
+    NGRAPH_API
+    void serialize_to_cpio(const std::string& path,
+                           std::shared_ptr<ngraph::Function> func,
+                           size_t indent = 0);
+
+    /// \brief Serialize a Function to a cpio archive with binary constant data
+    /// \param out The output stream to which the archive is written. Alignment of the constant
+    ///    data is relative to the stream position at the start of the archive.
+    /// \param func The Function to serialize
+    /// \param indent Formatting of the json graph, as for serialize()
+    NGRAPH_API
+    void serialize_to_cpio(std::ostream& out,
+                           std::shared_ptr<ngraph::Function> func,
+                           size_t indent = 0);
+
+    /// \brief Serialize the structure of a Function to a compact json string, for comparing or
+    ///    hashing graphs
+    ///
+    /// Function, node and tensor names are replaced by positions in the topological order, so
+    /// Functions built the same way serialize identically in different processes. The values of
+    /// Constants are left out.
+    /// \param func The Function to serialize
+    /// \param constants Receives the Constants whose values were left out, in serialization
+    ///    order
+    NGRAPH_API
+    std::string serialize_structure(std::shared_ptr<ngraph::Function> func,
+                                    std::vector<std::shared_ptr<ngraph::Node>>& constants);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     NGRAPH_API
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted string to deseriailze, or the path of a json or cpio
+    ///    file. A cpio file is memory-mapped and its Constants refer to the mapping.
     NGRAPH_API
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
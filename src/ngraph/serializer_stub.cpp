@@ -33,6 +33,26 @@ void ngraph::serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func
     throw std::runtime_error("serializer disabled in build");
 }
 
+void ngraph::serialize_to_cpio(const std::string& path,
+                               std::shared_ptr<ngraph::Function> func,
+                               size_t indent)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_to_cpio(std::ostream& out,
+                               std::shared_ptr<ngraph::Function> func,
+                               size_t indent)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+std::string ngraph::serialize_structure(std::shared_ptr<ngraph::Function> func,
+                                       std::vector<std::shared_ptr<ngraph::Node>>& constants)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
 std::shared_ptr<ngraph::Function> ngraph::deserialize(std::istream& in)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/strided_walk.hpp"
+#include "ngraph/check.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+StridedWalk::StridedWalk(const Shape& shape,
+                         const vector<ptrdiff_t>& src_strides,
+                         const vector<ptrdiff_t>& dst_strides,
+                         ptrdiff_t src_offset,
+                         ptrdiff_t dst_offset)
+    : m_src_offset(src_offset)
+    , m_dst_offset(dst_offset)
+    , m_run_length(1)
+    , m_src_run_stride(1)
+    , m_dst_run_stride(1)
+{
+    NGRAPH_CHECK(src_strides.size() == shape.size() && dst_strides.size() == shape.size(),
+                 "Strided walk needs one source and one destination stride per axis of ",
+                 shape);
+
+    if (shape_size(shape) == 0)
+    {
+        m_run_length = 0;
+        return;
+    }
+
+    // Drop unit axes and merge each axis into its outer neighbour when the pair is contiguous
+    // in both views
+    for (size_t axis = 0; axis < shape.size(); ++axis)
+    {
+        size_t length = shape[axis];
+        ptrdiff_t src_stride = src_strides[axis];
+        ptrdiff_t dst_stride = dst_strides[axis];
+        if (length == 1)
+        {
+            continue;
+        }
+        ptrdiff_t extent = static_cast<ptrdiff_t>(length);
+        if (!m_outer_shape.empty() && m_src_strides.back() == src_stride * extent &&
+            m_dst_strides.back() == dst_stride * extent)
+        {
+            m_outer_shape.back() *= length;
+            m_src_strides.back() = src_stride;
+            m_dst_strides.back() = dst_stride;
+        }
+        else
+        {
+            m_outer_shape.push_back(length);
+            m_src_strides.push_back(src_stride);
+            m_dst_strides.push_back(dst_stride);
+        }
+    }
+
+    // The innermost remaining axis becomes the run
+    if (!m_outer_shape.empty())
+    {
+        m_run_length = m_outer_shape.back();
+        m_src_run_stride = m_src_strides.back();
+        m_dst_run_stride = m_dst_strides.back();
+        m_outer_shape.pop_back();
+        m_src_strides.pop_back();
+        m_dst_strides.pop_back();
+    }
+
+    for (size_t axis = 0; axis < m_outer_shape.size(); ++axis)
+    {
+        ptrdiff_t extent = static_cast<ptrdiff_t>(m_outer_shape[axis]);
+        m_src_wrap.push_back(m_src_strides[axis] * extent);
+        m_dst_wrap.push_back(m_dst_strides[axis] * extent);
+    }
+}
+
+vector<ptrdiff_t> StridedWalk::row_major_strides(const Shape& shape)
+{
+    vector<ptrdiff_t> strides(shape.size());
+    ptrdiff_t stride = 1;
+    for (size_t i = shape.size(); i > 0; --i)
+    {
+        strides[i - 1] = stride;
+        stride *= static_cast<ptrdiff_t>(shape[i - 1]);
+    }
+    return strides;
+}
+
+vector<ptrdiff_t> StridedWalk::reduced_strides(const Shape& shape, const AxisSet& reduction_axes)
+{
+    vector<ptrdiff_t> strides(shape.size(), 0);
+    ptrdiff_t stride = 1;
+    for (size_t i = shape.size(); i > 0; --i)
+    {
+        if (reduction_axes.count(i - 1) == 0)
+        {
+            strides[i - 1] = stride;
+            stride *= static_cast<ptrdiff_t>(shape[i - 1]);
+        }
+    }
+    return strides;
+}
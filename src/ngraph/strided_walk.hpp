@@ -0,0 +1,161 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    /// \brief Row-major walk over an iteration space that tracks the element offsets of two
+    ///        strided views of it, a source and a destination.
+    ///
+    /// Unlike CoordinateTransform, no Coordinate is materialized and no per-axis multiply is done
+    /// per element. Axes of length 1 are dropped and adjacent axes that are contiguous in both
+    /// views are merged when the walk is built. What remains of the innermost axis is handed to
+    /// the caller as a run of run_length() elements with fixed strides, and the outer axes are
+    /// advanced odometer style by adding precomputed strides to the run offsets.
+    class NGRAPH_API StridedWalk
+    {
+    public:
+        /// \param shape Shape of the iteration space.
+        /// \param src_strides Element stride of each axis in the source view. May be zero
+        ///        (broadcast) or negative (reversal).
+        /// \param dst_strides Element stride of each axis in the destination view.
+        /// \param src_offset Source offset of the first element.
+        /// \param dst_offset Destination offset of the first element.
+        StridedWalk(const Shape& shape,
+                    const std::vector<std::ptrdiff_t>& src_strides,
+                    const std::vector<std::ptrdiff_t>& dst_strides,
+                    std::ptrdiff_t src_offset = 0,
+                    std::ptrdiff_t dst_offset = 0);
+
+        /// \brief Row-major element strides of a dense tensor of the given shape.
+        static std::vector<std::ptrdiff_t> row_major_strides(const Shape& shape);
+
+        /// \brief Strides of a dense tensor of shape reduce(shape, reduction_axes), given per
+        ///        axis of shape. Reduced axes get a stride of zero, so a walk over shape with
+        ///        these destination strides visits the reduced element each element folds into.
+        static std::vector<std::ptrdiff_t> reduced_strides(const Shape& shape,
+                                                           const AxisSet& reduction_axes);
+
+        /// \brief Number of elements in each run.
+        size_t get_run_length() const { return m_run_length; }
+        /// \brief Source stride between consecutive elements of a run.
+        std::ptrdiff_t get_src_run_stride() const { return m_src_run_stride; }
+        /// \brief Destination stride between consecutive elements of a run.
+        std::ptrdiff_t get_dst_run_stride() const { return m_dst_run_stride; }
+        /// \brief Number of outer axes left after collapsing.
+        size_t get_outer_rank() const { return m_outer_shape.size(); }
+        /// \brief Calls f(src_offset, dst_offset) with the offsets of the first element of every
+        ///        run, in row-major order.
+        template <typename F>
+        void for_each_run(F f) const
+        {
+            if (m_run_length == 0)
+            {
+                return;
+            }
+            const size_t rank = m_outer_shape.size();
+            std::ptrdiff_t src = m_src_offset;
+            std::ptrdiff_t dst = m_dst_offset;
+            if (rank == 0)
+            {
+                f(src, dst);
+                return;
+            }
+            std::vector<size_t> counter(rank, 0);
+            while (true)
+            {
+                f(src, dst);
+                size_t axis = rank;
+                while (true)
+                {
+                    if (axis == 0)
+                    {
+                        return;
+                    }
+                    --axis;
+                    src += m_src_strides[axis];
+                    dst += m_dst_strides[axis];
+                    if (++counter[axis] < m_outer_shape[axis])
+                    {
+                        break;
+                    }
+                    counter[axis] = 0;
+                    src -= m_src_wrap[axis];
+                    dst -= m_dst_wrap[axis];
+                }
+            }
+        }
+
+        /// \brief Copies every element of the source view to the same position of the
+        ///        destination view. Runs that are dense in both views are block copied.
+        template <typename T>
+        void copy(const T* src, T* dst) const
+        {
+            const size_t n = m_run_length;
+            const std::ptrdiff_t s_step = m_src_run_stride;
+            const std::ptrdiff_t d_step = m_dst_run_stride;
+            if (s_step == 1 && d_step == 1)
+            {
+                for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                    std::copy(src + s, src + s + n, dst + d);
+                });
+            }
+            else if (s_step == 0)
+            {
+                for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                    T* out = dst + d;
+                    const T value = src[s];
+                    for (size_t i = 0; i < n; ++i, out += d_step)
+                    {
+                        *out = value;
+                    }
+                });
+            }
+            else
+            {
+                for_each_run([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                    const T* in = src + s;
+                    T* out = dst + d;
+                    for (size_t i = 0; i < n; ++i, in += s_step, out += d_step)
+                    {
+                        *out = *in;
+                    }
+                });
+            }
+        }
+
+    private:
+        Shape m_outer_shape;
+        std::vector<std::ptrdiff_t> m_src_strides;
+        std::vector<std::ptrdiff_t> m_dst_strides;
+        std::vector<std::ptrdiff_t> m_src_wrap;
+        std::vector<std::ptrdiff_t> m_dst_wrap;
+        std::ptrdiff_t m_src_offset;
+        std::ptrdiff_t m_dst_offset;
+        size_t m_run_length;
+        std::ptrdiff_t m_src_run_stride;
+        std::ptrdiff_t m_dst_run_stride;
+    };
+}
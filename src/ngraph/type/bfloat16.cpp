@@ -32,6 +32,7 @@
 //==============================================================================
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 
@@ -64,6 +65,31 @@ std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f3
     return v_bf16;
 }
 
+void bfloat16::to_float(const bfloat16* in, float* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits = static_cast<uint32_t>(in[i].m_value) << 16;
+        memcpy(out + i, &bits, sizeof(bits));
+    }
+}
+
+void bfloat16::from_float(const float* in, bfloat16* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits;
+        memcpy(&bits, in + i, sizeof(bits));
+#if defined ROUND_MODE_TO_NEAREST
+        bits += 0x8000;
+#elif defined ROUND_MODE_TO_NEAREST_EVEN
+        // Add half of the dropped range only when the lowest kept bit is odd
+        bits += (bits & 0x00010000) >> 1;
+#endif
+        out[i].m_value = static_cast<uint16_t>(bits >> 16);
+    }
+}
+
 std::string bfloat16::to_string() const
 {
     return std::to_string(static_cast<float>(*this));
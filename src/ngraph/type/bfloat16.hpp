@@ -63,8 +63,34 @@ namespace ngraph
         bool operator>=(const bfloat16& other) const;
         operator float() const;
 
+        template <typename T>
+        bfloat16& operator+=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) + static_cast<float>(other));
+        }
+        template <typename T>
+        bfloat16& operator-=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) - static_cast<float>(other));
+        }
+        template <typename T>
+        bfloat16& operator*=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) * static_cast<float>(other));
+        }
+        template <typename T>
+        bfloat16& operator/=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) / static_cast<float>(other));
+        }
+
         static std::vector<float> to_float_vector(const std::vector<bfloat16>&);
         static std::vector<bfloat16> from_float_vector(const std::vector<float>&);
+        /// \brief Widens count values to f32. The loop is plain bit manipulation without
+        ///        branches so the compiler can vectorize it.
+        static void to_float(const bfloat16* in, float* out, size_t count);
+        /// \brief Converts count f32 values with the same rounding as bfloat16(float).
+        static void from_float(const float* in, bfloat16* out, size_t count);
         static constexpr bfloat16 from_bits(uint16_t bits) { return bfloat16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const bfloat16& obj)
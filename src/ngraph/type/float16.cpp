@@ -32,6 +32,7 @@
 //==============================================================================
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 
@@ -206,6 +207,65 @@ float16::operator float() const
     return f_val;
 }
 
+void float16::to_float(const float16* in, float* out, size_t count)
+{
+    constexpr uint32_t shifted_exp = 0x7C00 << 13;
+    // 2^-14, the smallest normal f16, with the exponent bias applied below
+    constexpr uint32_t magic_bits = 113 << 23;
+    float magic;
+    memcpy(&magic, &magic_bits, sizeof(magic));
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t h = in[i].m_value;
+        uint32_t bits = ((h & 0x7FFF) << 13) + ((127 - 15) << 23);
+        uint32_t exp = (h << 13) & shifted_exp;
+        // Inf and NaN keep an all ones exponent
+        bits += exp == shifted_exp ? (128 - 16) << 23 : 0;
+        // Zero and subnormals are renormalized by subtracting the implicit leading one
+        uint32_t subnormal_bits = bits + (1 << 23);
+        float subnormal;
+        memcpy(&subnormal, &subnormal_bits, sizeof(subnormal));
+        subnormal -= magic;
+        memcpy(&subnormal_bits, &subnormal, sizeof(subnormal));
+        bits = exp == 0 ? subnormal_bits : bits;
+        bits |= (h & 0x8000) << 16;
+        memcpy(out + i, &bits, sizeof(bits));
+    }
+}
+
+void float16::from_float(const float* in, float16* out, size_t count)
+{
+    constexpr uint32_t f32_infinity = 255u << 23;
+    // 2^16, the smallest magnitude that rounds to f16 infinity after the exponent bias
+    constexpr uint32_t f16_overflow = (127u + 16) << 23;
+    // 2^-14, below which results are f16 subnormals
+    constexpr uint32_t f16_min_normal = 113u << 23;
+    // 0.5, adding it aligns the f16 subnormal bits at the bottom of the f32 mantissa
+    constexpr uint32_t subnormal_magic_bits = ((127 - 15) + (23 - 10) + 1) << 23;
+    float subnormal_magic;
+    memcpy(&subnormal_magic, &subnormal_magic_bits, sizeof(subnormal_magic));
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits;
+        memcpy(&bits, in + i, sizeof(bits));
+        uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+        uint32_t special = bits > f32_infinity ? 0x7E00 : 0x7C00;
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        value += subnormal_magic;
+        uint32_t subnormal;
+        memcpy(&subnormal, &value, sizeof(subnormal));
+        subnormal -= subnormal_magic_bits;
+        // Rebias the exponent and round to nearest even on the 13 dropped mantissa bits
+        uint32_t mantissa_odd = (bits >> 13) & 1;
+        uint32_t normal = (bits - ((127u - 15) << 23) + 0xFFF + mantissa_odd) >> 13;
+        uint32_t result =
+            bits >= f16_overflow ? special : (bits < f16_min_normal ? subnormal : normal);
+        out[i].m_value = static_cast<uint16_t>(result | (sign >> 16));
+    }
+}
+
 bool std::isnan(float16 x)
 {
     // Sign doesn't matter, frac not zero (infinity)
@@ -58,6 +58,34 @@ namespace ngraph
         bool operator>=(const float16& other) const;
         operator float() const;
 
+        template <typename T>
+        float16& operator+=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) + static_cast<float>(other));
+        }
+        template <typename T>
+        float16& operator-=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) - static_cast<float>(other));
+        }
+        template <typename T>
+        float16& operator*=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) * static_cast<float>(other));
+        }
+        template <typename T>
+        float16& operator/=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) / static_cast<float>(other));
+        }
+
+        /// \brief Widens count values to f32. Unlike operator float the loop has no data
+        ///        dependent branches, so the compiler can vectorize it.
+        static void to_float(const float16* in, float* out, size_t count);
+        /// \brief Rounds count f32 values to nearest even. Values too large for f16 become
+        ///        infinity and every NaN becomes the quiet NaN 0x7E00.
+        static void from_float(const float* in, float16* out, size_t count);
+
         static constexpr float16 from_bits(uint16_t bits) { return float16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const float16& obj)
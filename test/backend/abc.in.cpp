@@ -89,3 +89,30 @@ NGRAPH_TEST(${BACKEND_NAME}, abc_int64)
     handle->call_with_validate({result}, {a, c, b});
     EXPECT_EQ((vector<int64_t>{50, 72, 98, 128}), read_vector<int64_t>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, abc_f16)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f16, shape);
+    auto B = make_shared<op::Parameter>(element::f16, shape);
+    auto C = make_shared<op::Parameter>(element::f16, shape);
+    auto f = make_shared<Function>((A + B) * C, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f16, shape);
+    copy_data(a, vector<float16>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f16, shape);
+    copy_data(b, vector<float16>{5, 6, 7, 8});
+    auto c = backend->create_tensor(element::f16, shape);
+    copy_data(c, vector<float16>{9, 10, 11, 12});
+    auto result = backend->create_tensor(element::f16, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_EQ((vector<float16>{54, 80, 110, 144}), read_vector<float16>(result));
+
+    handle->call_with_validate({result}, {a, c, b});
+    EXPECT_EQ((vector<float16>{50, 72, 98, 128}), read_vector<float16>(result));
+}
@@ -236,3 +236,196 @@ NGRAPH_TEST(${BACKEND_NAME}, dyn_convolution_backprop_filter)
     handle->call_with_validate({result}, {a, b, c});
     EXPECT_FALSE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
 }
+
+// A 2-D convolution that walks the padded and dilated input for every output and sums the
+// products in (tap, input channel) order
+static void naive_convolution(const vector<float>& in,
+                              const vector<float>& filter,
+                              vector<float>& out,
+                              const Shape& in_shape,
+                              const Shape& filter_shape,
+                              const Shape& out_shape,
+                              const Strides& stride,
+                              const Strides& filter_dilation,
+                              const CoordinateDiff& pad_below,
+                              const Strides& in_dilation)
+{
+    size_t channels = in_shape[1];
+    for (size_t n = 0; n < out_shape[0]; n++)
+    {
+        for (size_t co = 0; co < out_shape[1]; co++)
+        {
+            for (size_t oy = 0; oy < out_shape[2]; oy++)
+            {
+                for (size_t ox = 0; ox < out_shape[3]; ox++)
+                {
+                    double result = 0;
+                    for (size_t fy = 0; fy < filter_shape[2]; fy++)
+                    {
+                        for (size_t fx = 0; fx < filter_shape[3]; fx++)
+                        {
+                            ptrdiff_t y = oy * stride[0] + fy * filter_dilation[0] - pad_below[0];
+                            ptrdiff_t x = ox * stride[1] + fx * filter_dilation[1] - pad_below[1];
+                            if (y < 0 || x < 0 || y % in_dilation[0] != 0 ||
+                                x % in_dilation[1] != 0)
+                            {
+                                continue;
+                            }
+                            y /= in_dilation[0];
+                            x /= in_dilation[1];
+                            if (y >= static_cast<ptrdiff_t>(in_shape[2]) ||
+                                x >= static_cast<ptrdiff_t>(in_shape[3]))
+                            {
+                                continue;
+                            }
+                            for (size_t c = 0; c < channels; c++)
+                            {
+                                result += static_cast<double>(
+                                              in[((n * channels + c) * in_shape[2] + y) *
+                                                     in_shape[3] +
+                                                 x]) *
+                                          static_cast<double>(
+                                              filter[((co * channels + c) * filter_shape[2] + fy) *
+                                                         filter_shape[3] +
+                                                     fx]);
+                            }
+                        }
+                    }
+                    out[((n * out_shape[1] + co) * out_shape[2] + oy) * out_shape[3] + ox] =
+                        static_cast<float>(result);
+                }
+            }
+        }
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_2d_algorithm_cases)
+{
+    struct Case
+    {
+        Shape in_shape;
+        Shape filter_shape;
+        Strides stride;
+        Strides filter_dilation;
+        CoordinateDiff pad_below;
+        CoordinateDiff pad_above;
+        Strides in_dilation;
+    };
+    vector<Case> cases{
+        // im2col with padding, strides, filter dilation, data dilation and cropping
+        {{2, 3, 9, 11}, {4, 3, 3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+        {{2, 3, 9, 11}, {4, 3, 3, 2}, {2, 3}, {1, 1}, {0, 2}, {1, 0}, {1, 1}},
+        {{1, 5, 12, 10}, {2, 5, 3, 3}, {1, 1}, {2, 3}, {2, 1}, {2, 1}, {1, 1}},
+        {{1, 2, 6, 7}, {3, 2, 3, 3}, {1, 2}, {1, 1}, {1, 2}, {2, 1}, {2, 3}},
+        {{1, 4, 10, 10}, {3, 4, 2, 2}, {1, 1}, {1, 1}, {-1, 0}, {0, -2}, {1, 1}},
+        // Several blocks of output positions
+        {{1, 2, 24, 30}, {3, 2, 3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+        // 1x1 read in place, and strided or padded 1x1 through im2col
+        {{3, 6, 7, 9}, {5, 6, 1, 1}, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1}},
+        {{3, 6, 7, 9}, {5, 6, 1, 1}, {2, 2}, {1, 1}, {0, 0}, {0, 0}, {1, 1}},
+        {{3, 6, 7, 9}, {5, 6, 1, 1}, {1, 1}, {1, 1}, {1, 0}, {0, 1}, {1, 1}},
+        // A single input channel, as in each group of a depthwise convolution
+        {{2, 1, 17, 19}, {3, 1, 3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+        {{2, 1, 17, 19}, {1, 1, 5, 3}, {2, 1}, {1, 2}, {2, 0}, {2, 3}, {2, 1}},
+    };
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (const Case& c : cases)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, c.in_shape);
+        auto B = make_shared<op::Parameter>(element::f32, c.filter_shape);
+        auto conv = make_shared<op::Convolution>(
+            A, B, c.stride, c.filter_dilation, c.pad_below, c.pad_above, c.in_dilation);
+        auto f = make_shared<Function>(conv, ParameterVector{A, B});
+        Shape out_shape = conv->get_shape();
+
+        vector<float> in(shape_size(c.in_shape));
+        vector<float> filter(shape_size(c.filter_shape));
+        for (size_t i = 0; i < in.size(); i++)
+        {
+            in[i] = static_cast<float>(i % 97) / 13.0f - 3.0f;
+        }
+        for (size_t i = 0; i < filter.size(); i++)
+        {
+            filter[i] = static_cast<float>(i % 31) / 7.0f - 2.0f;
+        }
+        vector<float> expected(shape_size(out_shape));
+        naive_convolution(in,
+                          filter,
+                          expected,
+                          c.in_shape,
+                          c.filter_shape,
+                          out_shape,
+                          c.stride,
+                          c.filter_dilation,
+                          c.pad_below,
+                          c.in_dilation);
+
+        auto a = backend->create_tensor(element::f32, c.in_shape);
+        copy_data(a, in);
+        auto b = backend->create_tensor(element::f32, c.filter_shape);
+        copy_data(b, filter);
+        auto result = backend->create_tensor(element::f32, out_shape);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)))
+            << c.in_shape << " " << c.filter_shape;
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_benchmark)
+{
+    Shape in_shape{4, 16, 32, 32};
+    Shape filter_shape{32, 16, 3, 3};
+    Strides stride{1, 1};
+    Strides dilation{1, 1};
+    CoordinateDiff padding{1, 1};
+    Shape out_shape{4, 32, 32, 32};
+    vector<float> in(shape_size(in_shape));
+    vector<float> filter(shape_size(filter_shape));
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        in[i] = static_cast<float>(i % 97) / 13.0f;
+    }
+    for (size_t i = 0; i < filter.size(); i++)
+    {
+        filter[i] = static_cast<float>(i % 31) / 7.0f;
+    }
+    vector<float> expected(shape_size(out_shape));
+
+    stopwatch timer;
+    timer.start();
+    naive_convolution(in,
+                      filter,
+                      expected,
+                      in_shape,
+                      filter_shape,
+                      out_shape,
+                      stride,
+                      dilation,
+                      padding,
+                      dilation);
+    timer.stop();
+    double naive_ms = timer.get_milliseconds();
+
+    auto A = make_shared<op::Parameter>(element::f32, in_shape);
+    auto B = make_shared<op::Parameter>(element::f32, filter_shape);
+    auto f = make_shared<Function>(
+        make_shared<op::Convolution>(A, B, stride, dilation, padding, padding, dilation),
+        ParameterVector{A, B});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, in_shape);
+    copy_data(a, in);
+    auto b = backend->create_tensor(element::f32, filter_shape);
+    copy_data(b, filter);
+    auto result = backend->create_tensor(element::f32, out_shape);
+    auto handle = backend->compile(f);
+
+    timer.start();
+    handle->call_with_validate({result}, {a, b});
+    timer.stop();
+    double backend_ms = timer.get_milliseconds();
+
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    cout << "Direct loop nest: " << naive_ms << " ms" << endl;
+    cout << "${BACKEND_NAME} Convolution: " << backend_ms << " ms" << endl;
+}
@@ -793,3 +793,70 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_3d_one_axis_arbitrary)
                        27,   106, 149, 126, 65,  25,   44,   6,   11,  165,  281,  52}),
         read_vector<float>(result)));
 }
+
+// Shapes that do not divide evenly into the row tiles and column blocks of the reference kernel
+NGRAPH_TEST(${BACKEND_NAME}, dot_2d_partial_tiles)
+{
+    const size_t m = 7;
+    const size_t k = 9;
+    const size_t n = 70;
+    Shape shape_a{m, k};
+    Shape shape_b{k, n};
+    Shape shape_r{m, n};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    vector<float> a_data(m * k);
+    vector<float> b_data(k * n);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i % 11) - 5.f;
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<float>(i % 13) - 6.f;
+    }
+    vector<float> expected(m * n, 0.f);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t l = 0; l < k; l++)
+            {
+                expected[i * n + j] += a_data[i * k + l] * b_data[l * n + j];
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
+// 4096 is not reachable by adding ones in f16, where 2048 + 1 rounds back to 2048.
+NGRAPH_TEST(${BACKEND_NAME}, dot_f16_accumulates_in_f32)
+{
+    Shape shape{4096};
+    auto A = make_shared<op::Parameter>(element::f16, shape);
+    auto B = make_shared<op::Parameter>(element::f16, shape);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f16, shape);
+    copy_data(a, vector<float16>(shape_size(shape), float16(1.0f)));
+    auto b = backend->create_tensor(element::f16, shape);
+    copy_data(b, vector<float16>(shape_size(shape), float16(1.0f)));
+    auto result = backend->create_tensor(element::f16, Shape{});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(4096.0f, static_cast<float>(read_vector<float16>(result)[0]));
+}
@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -292,3 +293,35 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_executable_cache)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic()});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Negative>(a)}, ParameterVector{a});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    string error;
+    EXPECT_FALSE(backend->set_config({{"dynamic_cache_capacity", "-1"}}, error));
+    if (!backend->set_config({{"dynamic_cache_capacity", "2"}}, error))
+    {
+        // The backend handles dynamic shapes natively
+        return;
+    }
+    auto ex = backend->compile(f);
+    auto cache = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex)->get_cache();
+    ASSERT_EQ(cache->get_capacity(), 2u);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{Dimension::dynamic()});
+    for (size_t size : {1, 2, 1, 2, 3, 1})
+    {
+        auto t_a = backend->create_tensor(element::f32, Shape{size});
+        copy_data(t_a, vector<float>(size, 1.0f));
+        ex->call_with_validate({t_r}, {t_a});
+        EXPECT_EQ(read_vector<float>(t_r), vector<float>(size, -1.0f));
+    }
+    // Sizes 1 and 2 hit on their second call; 3 evicts 1, so the last call misses
+    EXPECT_EQ(cache->get_hit_count(), 2u);
+    EXPECT_EQ(cache->get_miss_count(), 4u);
+    EXPECT_EQ(cache->get_eviction_count(), 2u);
+    EXPECT_EQ(cache->size(), 2u);
+}
@@ -504,3 +504,45 @@ NGRAPH_TEST(${BACKEND_NAME}, max_3d_eliminate_zero_dim)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ((vector<float>{mi, mi, mi, mi, mi, mi}), read_vector<float>(result));
 }
+
+// Every subset of axes, so inner contiguous, outer and interleaved reductions are all hit
+NGRAPH_TEST(${BACKEND_NAME}, max_all_axis_subsets)
+{
+    Shape shape{3, 4, 5, 6};
+    vector<float> a_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>((i * 7) % 23) - 11.0f;
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    for (size_t mask = 0; mask < (1u << shape.size()); mask++)
+    {
+        AxisSet axes;
+        for (size_t axis = 0; axis < shape.size(); axis++)
+        {
+            if (mask & (1u << axis))
+            {
+                axes.insert(axis);
+            }
+        }
+        Shape shape_r = reduce(shape, axes);
+        CoordinateTransform input_transform(shape);
+        CoordinateTransform output_transform(shape_r);
+        vector<float> expected(shape_size(shape_r), -numeric_limits<float>::infinity());
+        for (const Coordinate& input_coord : input_transform)
+        {
+            float& r = expected[output_transform.index(reduce(input_coord, axes))];
+            r = std::max(r, a_data[input_transform.index(input_coord)]);
+        }
+
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::Max>(A, axes), ParameterVector{A});
+        auto result = backend->create_tensor(element::f32, shape_r);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_EQ(read_vector<float>(result), expected) << axes;
+    }
+}
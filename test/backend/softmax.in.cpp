@@ -290,3 +290,31 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_overflow)
                            expf(5) / d2};
     EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, softmax_f16)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f16, shape);
+    auto f = make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{1}), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> a_data{-3, -2, -1, 0, 1, 2};
+    vector<float16> a_f16(a_data.size());
+    float16::from_float(a_data.data(), a_f16.data(), a_data.size());
+    auto a = backend->create_tensor(element::f16, shape);
+    copy_data(a, a_f16);
+    auto result = backend->create_tensor(element::f16, shape);
+
+    auto d0 = expf(-3) + expf(-2) + expf(-1);
+    auto d1 = expf(0) + expf(1) + expf(2);
+    vector<float> expected{
+        expf(-3) / d0, expf(-2) / d0, expf(-1) / d0, expf(0) / d1, expf(1) / d1, expf(2) / d1};
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    vector<float16> r_f16 = read_vector<float16>(result);
+    vector<float> r(r_f16.size());
+    float16::to_float(r_f16.data(), r.data(), r_f16.size());
+    EXPECT_TRUE(test::all_close(expected, r, 1e-3f, 1e-3f));
+}
@@ -778,3 +778,117 @@ NGRAPH_TEST(${BACKEND_NAME}, sum_inf)
     EXPECT_TRUE(isnan(r[5]));
     EXPECT_TRUE(isnan(r[6]));
 }
+
+// Adding ones stops at 2048 in f16 and at 256 in bf16 unless the sum is kept in f32.
+NGRAPH_TEST(${BACKEND_NAME}, sum_half_precision_accumulates_in_f32)
+{
+    Shape shape{4096};
+    auto A = make_shared<op::Parameter>(element::f16, shape);
+    auto B = make_shared<op::Parameter>(element::bf16, shape);
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::Sum>(A, AxisSet{0}), make_shared<op::Sum>(B, AxisSet{0})},
+        ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f16, shape);
+    copy_data(a, vector<float16>(shape_size(shape), float16(1.0f)));
+    auto b = backend->create_tensor(element::bf16, shape);
+    copy_data(b, vector<bfloat16>(shape_size(shape), bfloat16(1.0f)));
+    auto result_a = backend->create_tensor(element::f16, Shape{});
+    auto result_b = backend->create_tensor(element::bf16, Shape{});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_a, result_b}, {a, b});
+    EXPECT_EQ(4096.0f, static_cast<float>(read_vector<float16>(result_a)[0]));
+    EXPECT_EQ(4096.0f, static_cast<float>(read_vector<bfloat16>(result_b)[0]));
+}
+
+// Every subset of axes, so inner contiguous, outer and interleaved reductions are all hit
+NGRAPH_TEST(${BACKEND_NAME}, sum_all_axis_subsets)
+{
+    Shape shape{3, 4, 5, 6};
+    vector<float> a_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>((i * 7) % 23) - 11.0f;
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    for (size_t mask = 0; mask < (1u << shape.size()); mask++)
+    {
+        AxisSet axes;
+        for (size_t axis = 0; axis < shape.size(); axis++)
+        {
+            if (mask & (1u << axis))
+            {
+                axes.insert(axis);
+            }
+        }
+        Shape shape_r = reduce(shape, axes);
+        CoordinateTransform input_transform(shape);
+        CoordinateTransform output_transform(shape_r);
+        vector<float> expected(shape_size(shape_r), 0.0f);
+        for (const Coordinate& input_coord : input_transform)
+        {
+            expected[output_transform.index(reduce(input_coord, axes))] +=
+                a_data[input_transform.index(input_coord)];
+        }
+
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::Sum>(A, axes), ParameterVector{A});
+        auto result = backend->create_tensor(element::f32, shape_r);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_EQ(read_vector<float>(result), expected) << axes;
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, sum_benchmark)
+{
+    Shape shape{64, 32, 48, 40};
+    AxisSet axes{1, 3};
+    Shape shape_r = reduce(shape, axes);
+    size_t element_count = shape_size(shape);
+    vector<float> a_data(element_count);
+    for (size_t i = 0; i < element_count; i++)
+    {
+        a_data[i] = static_cast<float>(i % 1000) / 7.0f;
+    }
+    vector<float> expected(shape_size(shape_r), 0.0f);
+    vector<float> compensation(shape_size(shape_r), 0.0f);
+
+    // The per element Kahan loop the reference sum used to do
+    stopwatch timer;
+    timer.start();
+    CoordinateTransform input_transform(shape);
+    CoordinateTransform output_transform(shape_r);
+    for (const Coordinate& input_coord : input_transform)
+    {
+        size_t o = output_transform.index(reduce(input_coord, axes));
+        float x = a_data[input_transform.index(input_coord)];
+        float t = expected[o] + (x - compensation[o]);
+        compensation[o] = (t - expected[o]) - (x - compensation[o]);
+        expected[o] = t;
+    }
+    timer.stop();
+    double coordinate_ns = static_cast<double>(timer.get_nanoseconds()) / element_count;
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Sum>(A, axes), ParameterVector{A});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+    auto handle = backend->compile(f);
+
+    timer.start();
+    handle->call_with_validate({result}, {a});
+    timer.stop();
+    double backend_ns = static_cast<double>(timer.get_nanoseconds()) / element_count;
+
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    cout << "CoordinateTransform: " << coordinate_ns << " ns/element" << endl;
+    cout << "${BACKEND_NAME} Sum: " << backend_ns << " ns/element" << endl;
+}
@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Slices along an inner axis are strided, so the inputs are gathered and the concat output is
+// scattered on every iteration
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_strided_axis)
+{
+    const size_t N = 2;
+    const size_t L = 5;
+    const size_t C = 3;
+    auto X = make_shared<op::Parameter>(element::f32, Shape{N, L, C});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{N, 1, C});
+    auto M = make_shared<op::Parameter>(element::f32, Shape{N, 1, C});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{N, 1, C});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{N, 1, C});
+    auto M_body = make_shared<op::Parameter>(element::f32, Shape{N, 1, C});
+    auto Ho = (Hi + Xi) * M_body;
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho},
+                                                            ParameterVector{Xi, Hi, M_body});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    // start=0, stride=1, part_size=1, end=-1, axis=1
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 1);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    tensor_iterator->set_invariant_input(M_body, M);
+    auto out0 = tensor_iterator->get_iter_value(Ho, -1);
+    auto out1 = tensor_iterator->get_concatenated_slices(Ho, 0, 1, 1, -1, 1);
+
+    auto f = make_shared<Function>(OutputVector{out0, out1}, ParameterVector{X, H_init, M});
+
+    vector<float> x(N * L * C);
+    vector<float> h_init(N * C);
+    vector<float> m(N * C);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = 0.25f * i - 3.0f;
+    }
+    for (size_t i = 0; i < h_init.size(); ++i)
+    {
+        h_init[i] = 1.0f - 0.5f * i;
+        m[i] = 0.5f + 0.125f * i;
+    }
+
+    vector<float> expected_last(h_init);
+    vector<float> expected_sequence(N * L * C);
+    for (size_t t = 0; t < L; ++t)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            for (size_t c = 0; c < C; ++c)
+            {
+                float& h = expected_last[n * C + c];
+                h = (h + x[(n * L + t) * C + c]) * m[n * C + c];
+                expected_sequence[(n * L + t) * C + c] = h;
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x_tensor = backend->create_tensor(element::f32, X->get_shape());
+    auto h_init_tensor = backend->create_tensor(element::f32, H_init->get_shape());
+    auto m_tensor = backend->create_tensor(element::f32, M->get_shape());
+    copy_data(x_tensor, x);
+    copy_data(h_init_tensor, h_init);
+    copy_data(m_tensor, m);
+    auto last = backend->create_tensor(element::f32, Shape{N, 1, C});
+    auto sequence = backend->create_tensor(element::f32, Shape{N, L, C});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({last, sequence}, {x_tensor, h_init_tensor, m_tensor});
+    EXPECT_TRUE(test::all_close_f(expected_last, read_vector<float>(last)));
+    EXPECT_TRUE(test::all_close_f(expected_sequence, read_vector<float>(sequence)));
+}
+
+// Slices along the outermost axis are contiguous, so the body reads the input and writes the
+// concat output in place. The input is walked backwards and one output is taken mid-sequence.
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_reverse_outer_axis)
+{
+    const size_t L = 5;
+    const size_t C = 2;
+    auto X = make_shared<op::Parameter>(element::f32, Shape{L, C});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{1, C});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{1, C});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{1, C});
+    auto Ho = Hi * Hi + Xi;
+    auto body =
+        make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho}, ParameterVector{Xi, Hi});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    // start=-1, stride=-1, part_size=1, end=0, axis=0
+    tensor_iterator->set_sliced_input(Xi, X, -1, -1, 1, 0, 0);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    auto out0 = tensor_iterator->get_concatenated_slices(Ho, 0, 1, 1, -1, 0);
+    auto out1 = tensor_iterator->get_iter_value(Ho, 1);
+
+    auto f = make_shared<Function>(OutputVector{out0, out1}, ParameterVector{X, H_init});
+
+    vector<float> x{0.5f, -0.25f, 0.125f, 0.0f, -0.5f, 0.75f, 0.25f, -0.125f, 0.375f, 0.5f};
+    vector<float> h_init{0.5f, -0.5f};
+
+    vector<float> h(h_init);
+    vector<float> expected_sequence;
+    vector<float> expected_second;
+    for (size_t t = 0; t < L; ++t)
+    {
+        for (size_t c = 0; c < C; ++c)
+        {
+            h[c] = h[c] * h[c] + x[(L - 1 - t) * C + c];
+        }
+        expected_sequence.insert(expected_sequence.end(), h.begin(), h.end());
+        if (t == 1)
+        {
+            expected_second = h;
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x_tensor = backend->create_tensor(element::f32, X->get_shape());
+    auto h_init_tensor = backend->create_tensor(element::f32, H_init->get_shape());
+    copy_data(x_tensor, x);
+    copy_data(h_init_tensor, h_init);
+    auto sequence = backend->create_tensor(element::f32, Shape{L, C});
+    auto second = backend->create_tensor(element::f32, Shape{1, C});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({sequence, second}, {x_tensor, h_init_tensor});
+    EXPECT_TRUE(test::all_close_f(expected_sequence, read_vector<float>(sequence)));
+    EXPECT_TRUE(test::all_close_f(expected_second, read_vector<float>(second)));
+}
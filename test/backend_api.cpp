@@ -14,9 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
 #include "gtest/gtest.h"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batcher.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
@@ -91,6 +99,72 @@ TEST(backend_api, save_load)
 }
 #endif
 
+#ifndef NGRAPH_JSON_DISABLE
+TEST(backend_api, executable_cache)
+{
+    Shape shape{2, 2};
+    auto make_function = [&](const vector<float>& values) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = op::Constant::create(element::f32, shape, values);
+        return make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A});
+    };
+    string dir =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_executable_cache");
+    file_util::remove_directory(dir);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data<float>(a, {10.f, 20.f, 30.f, 40.f});
+    {
+        runtime::ExecutableCache cache(backend, "INTERPRETER", dir);
+        ASSERT_NE(cache.compile(make_function({1, 2, 3, 4})), nullptr);
+        EXPECT_EQ(cache.get_miss_count(), 1u);
+        EXPECT_EQ(cache.get_hit_count(), 0u);
+    }
+    {
+        // A new cache over the same directory, as after a restart, and a graph rebuilt with
+        // different node names
+        runtime::ExecutableCache cache(backend, "INTERPRETER", dir);
+        auto handle = cache.compile(make_function({1, 2, 3, 4}));
+        ASSERT_NE(handle, nullptr);
+        EXPECT_EQ(cache.get_hit_count(), 1u);
+        EXPECT_EQ(cache.get_miss_count(), 0u);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {11.f, 22.f, 33.f, 44.f}));
+
+        // Different constant data is a different entry
+        handle = cache.compile(make_function({5, 6, 7, 8}));
+        EXPECT_EQ(cache.get_miss_count(), 1u);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {15.f, 26.f, 37.f, 48.f}));
+    }
+    {
+        // A limit below the size of one entry keeps only the newest one
+        runtime::ExecutableCache cache(backend, "INTERPRETER", dir, 1);
+        cache.compile(make_function({0, 0, 0, 0}));
+        EXPECT_EQ(cache.get_miss_count(), 1u);
+        EXPECT_EQ(cache.get_eviction_count(), 2u);
+        cache.compile(make_function({0, 0, 0, 0}));
+        EXPECT_EQ(cache.get_hit_count(), 1u);
+    }
+    {
+        // Executables compiled under a different backend config are different entries
+        auto threaded_backend = runtime::Backend::create("INTERPRETER");
+        string error;
+        ASSERT_TRUE(threaded_backend->set_config({{"inter_op_threads", "2"}}, error));
+        runtime::ExecutableCache cache(threaded_backend, "INTERPRETER", dir);
+        cache.compile(make_function({0, 0, 0, 0}));
+        EXPECT_EQ(cache.get_miss_count(), 1u);
+        auto handle = cache.compile(make_function({0, 0, 0, 0}));
+        EXPECT_EQ(cache.get_hit_count(), 1u);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {10.f, 20.f, 30.f, 40.f}));
+    }
+    file_util::remove_directory(dir);
+}
+#endif
+
 #if defined(NGRAPH_INTERPRETER_ENABLE) && defined(NGRAPH_CPU_ENABLE)
 TEST(backend_api, executable_can_create_tensor)
 {
@@ -101,3 +175,373 @@ TEST(backend_api, executable_can_create_tensor)
     EXPECT_TRUE(cpu->executable_can_create_tensors());
 }
 #endif
+
+TEST(backend_api, interpreter_repeated_call)
+{
+    // Intermediates live in an arena that is reused by every call, so stale values from an
+    // earlier call must never leak into a later one
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::Add>(A, B);
+    auto t1 = make_shared<op::Multiply>(t0, C);
+    auto t2 = make_shared<op::Subtract>(t1, A);
+    auto f = make_shared<Function>(NodeVector{t2, t0}, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> c = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r0 = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r1 = backend->create_tensor(element::f32, shape);
+
+    for (float i = 0; i < 3; i++)
+    {
+        copy_data<float>(a, {1.f + i, 2.f, 3.f, 4.f});
+        copy_data<float>(b, {5.f, 6.f + i, 7.f, 8.f});
+        copy_data<float>(c, {1.f, 1.f, 2.f + i, 2.f});
+        handle->call_with_validate({r0, r1}, {a, b, c});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(r0),
+                                      {5.f, 6.f + i, 17.f + 10.f * i, 20.f}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(r1), {6.f + i, 8.f + i, 10.f, 12.f}));
+    }
+}
+
+TEST(backend_api, interpreter_concurrent_call)
+{
+    Shape shape{1024};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::Add>(A, B);
+    auto t1 = make_shared<op::Multiply>(t0, t0);
+    auto f = make_shared<Function>(make_shared<op::Negative>(t1), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+
+    vector<thread> threads;
+    vector<int> passed(4, 0);
+    for (size_t t = 0; t < passed.size(); t++)
+    {
+        threads.push_back(thread([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            copy_data(a, vector<float>(shape_size(shape), static_cast<float>(t)));
+            copy_data(b, vector<float>(shape_size(shape), 1.f));
+            bool ok = true;
+            for (size_t i = 0; i < 20; i++)
+            {
+                handle->call_with_validate({result}, {a, b});
+                float expected = -static_cast<float>((t + 1) * (t + 1));
+                ok = ok && test::all_close_f(read_vector<float>(result),
+                                             vector<float>(shape_size(shape), expected));
+            }
+            passed[t] = ok ? 1 : 0;
+        }));
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (int ok : passed)
+    {
+        EXPECT_EQ(ok, 1);
+    }
+}
+
+TEST(backend_api, begin_execute)
+{
+    Shape shape{1024};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> futures;
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>(shape_size(shape), 1.f));
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), static_cast<float>(i)));
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(handle->begin_execute({results.back()}, {a, b}));
+    }
+    for (size_t i = 0; i < futures.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(results[i]),
+                                      vector<float>(shape_size(shape), i + 1.f)));
+    }
+}
+
+TEST(backend_api, begin_execute_serializes_non_reentrant)
+{
+    // Counts the calls running at once, which must never exceed one
+    class SerialExecutable : public runtime::Executable
+    {
+    public:
+        bool call(const vector<shared_ptr<runtime::Tensor>>&,
+                  const vector<shared_ptr<runtime::Tensor>>&) override
+        {
+            size_t running = ++m_running;
+            m_max_running = max(m_max_running.load(), running);
+            this_thread::sleep_for(chrono::milliseconds(1));
+            --m_running;
+            return true;
+        }
+        atomic<size_t> m_running{0};
+        atomic<size_t> m_max_running{0};
+    };
+
+    SerialExecutable executable;
+    EXPECT_FALSE(executable.is_reentrant());
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < 16; i++)
+    {
+        futures.push_back(executable.begin_execute({}, {}));
+    }
+    for (future<bool>& f : futures)
+    {
+        EXPECT_TRUE(f.get());
+    }
+    EXPECT_EQ(executable.m_max_running, 1u);
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Abs>(A), ParameterVector{A});
+    auto backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_TRUE(backend->compile(f)->is_reentrant());
+    EXPECT_FALSE(backend->compile(f, true)->is_reentrant());
+}
+
+TEST(backend_api, batcher)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 3});
+    auto squared = make_shared<op::Multiply>(A, A);
+    auto f = make_shared<Function>(NodeVector{squared, make_shared<op::Sum>(squared, AxisSet{1})},
+                                   ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    struct Request
+    {
+        shared_ptr<runtime::Tensor> input;
+        shared_ptr<runtime::Tensor> squares;
+        shared_ptr<runtime::Tensor> sums;
+        future<bool> done;
+    };
+    auto submit = [&](runtime::Batcher& batcher, size_t batch, float value) {
+        Request request;
+        request.input = backend->create_tensor(element::f32, Shape{batch, 3});
+        request.squares = backend->create_tensor(element::f32, Shape{batch, 3});
+        request.sums = backend->create_tensor(element::f32, Shape{batch});
+        vector<float> values;
+        for (size_t i = 0; i < batch * 3; i++)
+        {
+            values.push_back(value + i);
+        }
+        copy_data(request.input, values);
+        request.done = batcher.submit({request.squares, request.sums}, {request.input});
+        return request;
+    };
+    auto check = [&](Request& request) {
+        EXPECT_TRUE(request.done.get());
+        vector<float> values = read_vector<float>(request.input);
+        vector<float> expected_squares;
+        vector<float> expected_sums;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            expected_squares.push_back(values[i] * values[i]);
+            if (i % 3 == 0)
+            {
+                expected_sums.push_back(0.f);
+            }
+            expected_sums.back() += values[i] * values[i];
+        }
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(request.squares), expected_squares));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(request.sums), expected_sums));
+    };
+
+    {
+        // A long budget, so batches are only cut when they are full
+        runtime::Batcher batcher(backend, f, 4, chrono::seconds(10));
+        vector<Request> requests;
+        for (size_t i = 0; i < 8; i++)
+        {
+            requests.push_back(submit(batcher, 1, static_cast<float>(i)));
+        }
+        for (Request& request : requests)
+        {
+            check(request);
+        }
+        EXPECT_EQ(batcher.get_call_count(), 2u);
+    }
+    {
+        // A short budget runs a partial batch, and a request larger than the limit runs alone
+        runtime::Batcher batcher(backend, f, 4, chrono::microseconds(100));
+        Request small = submit(batcher, 2, 1.f);
+        check(small);
+        Request large = submit(batcher, 6, -4.f);
+        check(large);
+        EXPECT_EQ(batcher.get_call_count(), 2u);
+        EXPECT_ANY_THROW(batcher.submit({small.squares}, {small.input}));
+    }
+    {
+        // Bad requests are rejected on submit and do not fail the requests they would join
+        runtime::Batcher batcher(backend, f, 4, chrono::seconds(10));
+        Request good = submit(batcher, 1, 2.f);
+        auto input = backend->create_tensor(element::f32, Shape{1, 3});
+        auto squares = backend->create_tensor(element::f32, Shape{1, 3});
+        auto sums = backend->create_tensor(element::f32, Shape{1});
+        EXPECT_ANY_THROW(batcher.submit({squares, sums},
+                                        {backend->create_tensor(element::f32, Shape{})}));
+        EXPECT_ANY_THROW(batcher.submit({squares, sums},
+                                        {backend->create_tensor(element::i32, Shape{1, 3})}));
+        EXPECT_ANY_THROW(batcher.submit({squares, sums},
+                                        {backend->create_tensor(element::f32, Shape{1, 4})}));
+        EXPECT_ANY_THROW(batcher.submit(
+            {backend->create_tensor(element::f32, Shape{2, 3}), sums}, {input}));
+        EXPECT_ANY_THROW(batcher.submit(
+            {squares, backend->create_tensor(element::f64, Shape{1})}, {input}));
+        Request other = submit(batcher, 3, 5.f);
+        check(good);
+        check(other);
+        EXPECT_EQ(batcher.get_call_count(), 1u);
+    }
+}
+
+TEST(backend_api, interpreter_inter_op_threads)
+{
+    // Several independent branches joined at the end so there is work to run concurrently
+    Shape shape{16, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    NodeVector branches;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto scale =
+            op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), i + 1.f));
+        auto dot = make_shared<op::Dot>(make_shared<op::Multiply>(A, scale), B);
+        branches.push_back(make_shared<op::Tanh>(dot));
+    }
+    auto sum = branches[0];
+    for (size_t i = 1; i < branches.size(); i++)
+    {
+        sum = make_shared<op::Add>(sum, branches[i]);
+    }
+    auto f = make_shared<Function>(sum, ParameterVector{A, B});
+
+    auto serial_backend = runtime::Backend::create("INTERPRETER");
+    auto parallel_backend = runtime::Backend::create("INTERPRETER");
+    string error;
+    EXPECT_FALSE(parallel_backend->set_config({{"inter_op_threads", "many"}}, error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(parallel_backend->set_config({{"inter_op_threads", "4"}}, error));
+
+    auto a = serial_backend->create_tensor(element::f32, shape);
+    auto b = serial_backend->create_tensor(element::f32, shape);
+    vector<float> a_data(shape_size(shape));
+    vector<float> b_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i % 7) / 50.f;
+        b_data[i] = static_cast<float>(i % 5) / 30.f;
+    }
+    copy_data(a, a_data);
+    copy_data(b, b_data);
+
+    auto expected = serial_backend->create_tensor(element::f32, shape);
+    serial_backend->compile(f)->call_with_validate({expected}, {a, b});
+
+    auto handle = parallel_backend->compile(f, true);
+    auto result = parallel_backend->create_tensor(element::f32, shape);
+    for (size_t i = 0; i < 10; i++)
+    {
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_EQ(read_vector<float>(result), read_vector<float>(expected));
+    }
+
+    bool found_dot = false;
+    for (const runtime::PerformanceCounter& counter : handle->get_performance_data())
+    {
+        if (is_type<op::Dot>(counter.get_node()))
+        {
+            found_dot = true;
+            EXPECT_EQ(counter.call_count(), 10u);
+        }
+    }
+    EXPECT_TRUE(found_dot);
+}
+
+TEST(backend_api, interpreter_native_fused_ops)
+{
+    Shape shape{2, 3, 4, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto scale = make_shared<op::Parameter>(element::f32, Shape{20});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{20});
+    auto layer_norm = make_shared<op::LayerNorm>(A, scale, bias, true, 2);
+    auto gelu = make_shared<op::Gelu>(layer_norm->output(0));
+    auto mvn = make_shared<op::MVN>(gelu, false, true);
+    auto axes = op::Constant::create(element::i64, Shape{2}, {1, 3});
+    auto normalize = make_shared<op::NormalizeL2>(mvn, axes, 1e-7f, op::EpsMode::MAX);
+    auto f = make_shared<Function>(
+        OutputVector{normalize, layer_norm->output(1), layer_norm->output(2)},
+        ParameterVector{A, scale, bias});
+
+    auto native_backend = runtime::Backend::create("INTERPRETER");
+    auto decomposing_backend = runtime::Backend::create("INTERPRETER");
+    string error;
+    EXPECT_FALSE(native_backend->set_config({{"native_fused_ops", "LayerNorm, Gemm"}}, error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(decomposing_backend->set_config({{"native_fused_ops", ""}}, error));
+
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (auto& parameter : f->get_parameters())
+    {
+        auto tensor = native_backend->create_tensor(element::f32, parameter->get_shape());
+        vector<float> data(shape_size(parameter->get_shape()));
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            data[i] = static_cast<float>((i * 37) % 11) / 4.f - 1.f;
+        }
+        copy_data(tensor, data);
+        args.push_back(tensor);
+    }
+
+    auto native = native_backend->compile(f, true);
+    auto decomposed = decomposing_backend->compile(f);
+    vector<shared_ptr<runtime::Tensor>> expected;
+    vector<shared_ptr<runtime::Tensor>> results;
+    for (size_t i = 0; i < f->get_output_size(); i++)
+    {
+        expected.push_back(
+            decomposing_backend->create_tensor(element::f32, f->get_output_shape(i)));
+        results.push_back(native_backend->create_tensor(element::f32, f->get_output_shape(i)));
+    }
+    decomposed->call_with_validate(expected, args);
+    native->call_with_validate(results, args);
+    for (size_t i = 0; i < f->get_output_size(); i++)
+    {
+        // The native kernels accumulate in double, so the last bits can differ
+        EXPECT_TRUE(
+            test::all_close_f(read_vector<float>(expected[i]), read_vector<float>(results[i])))
+            << "output " << i;
+    }
+
+    set<string> ops_run;
+    for (const runtime::PerformanceCounter& counter : native->get_performance_data())
+    {
+        ops_run.insert(counter.get_node()->description());
+    }
+    for (auto name : {"LayerNorm", "Gelu", "MVN", "NormalizeL2"})
+    {
+        EXPECT_EQ(ops_run.count(name), 1u) << name;
+    }
+    EXPECT_EQ(ops_run.count("Sqrt"), 0u);
+}
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <string>
@@ -74,3 +76,53 @@ TEST(INTERPRETER, nan_check_output)
     ihandle->set_nan_check(true);
     EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
 }
+
+TEST(INTERPRETER, concurrent_memory_layout)
+{
+    // On a thread pool the two chains may run at the same time, so neither can reuse the
+    // other's buffers; a buffer is only reused once all of its readers precede the op
+    Shape shape{256};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto x = make_shared<op::Negative>(make_shared<op::Negative>(
+        make_shared<op::Negative>(make_shared<op::Negative>(A))));
+    auto y = make_shared<op::Negative>(make_shared<op::Negative>(make_shared<op::Abs>(A)));
+    auto f = make_shared<Function>(NodeVector{x, y}, ParameterVector{A});
+    size_t tensor_size = shape_size(shape) * sizeof(float);
+
+    auto serial_backend = runtime::Backend::create("INTERPRETER");
+    auto serial = static_pointer_cast<runtime::interpreter::INTExecutable>(
+        serial_backend->compile(f));
+
+    auto parallel_backend = runtime::Backend::create("INTERPRETER");
+    string error;
+    ASSERT_TRUE(parallel_backend->set_config({{"inter_op_threads", "2"}}, error));
+    auto parallel = static_pointer_cast<runtime::interpreter::INTExecutable>(
+        parallel_backend->compile(f));
+    EXPECT_EQ(parallel->get_temporary_pool_size(), 4 * tensor_size);
+    EXPECT_LT(serial->get_temporary_pool_size(), parallel->get_temporary_pool_size());
+
+    // A loaded executable gets the backend's thread pool, and with it the same layout
+    stringstream saved;
+    parallel->save(saved);
+    auto loaded = static_pointer_cast<runtime::interpreter::INTExecutable>(
+        parallel_backend->load(saved));
+    EXPECT_EQ(loaded->get_temporary_pool_size(), 4 * tensor_size);
+
+    auto a = parallel_backend->create_tensor(element::f32, shape);
+    vector<float> values(shape_size(shape));
+    iota(values.begin(), values.end(), -128.f);
+    copy_data(a, values);
+    auto x_result = parallel_backend->create_tensor(element::f32, shape);
+    auto y_result = parallel_backend->create_tensor(element::f32, shape);
+    vector<float> expected_y;
+    for (float value : values)
+    {
+        expected_y.push_back(abs(value));
+    }
+    for (size_t i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(loaded->call_with_validate({x_result, y_result}, {a}));
+        EXPECT_EQ(read_vector<float>(x_result), values);
+        EXPECT_EQ(read_vector<float>(y_result), expected_y);
+    }
+}
@@ -259,3 +259,25 @@ TEST(bfloat16, assigns)
         EXPECT_EQ(f32arr[i], bf16arr[i]);
     }
 }
+
+TEST(bfloat16, bulk_conversions)
+{
+    vector<float> values{1.0f,
+                         -1.03125f,
+                         3.14159f,
+                         1.00390625f,
+                         1.01171875f,
+                         1.0e-30f,
+                         -65519.0f,
+                         numeric_limits<float>::max(),
+                         numeric_limits<float>::infinity()};
+    vector<bfloat16> converted(values.size());
+    bfloat16::from_float(values.data(), converted.data(), values.size());
+    vector<float> widened(values.size());
+    bfloat16::to_float(converted.data(), widened.data(), converted.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(converted[i].to_bits(), bfloat16(values[i]).to_bits());
+        EXPECT_EQ(widened[i], static_cast<float>(bfloat16(values[i])));
+    }
+}
@@ -236,3 +236,44 @@ TEST(build_graph, default_output_checks)
         FAIL() << "nullptr initialization of Output failed";
     }
 }
+
+TEST(build_graph, ordered_ops_cache)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto add = make_shared<op::Add>(a, b);
+    auto abs = make_shared<op::Abs>(add);
+    auto f = make_shared<Function>(abs, ParameterVector{a, b});
+    auto position = [&f](const shared_ptr<Node>& node) {
+        auto ops = f->get_ordered_ops();
+        return find(ops.begin(), ops.end(), node) - ops.begin();
+    };
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops.size(), 5u);
+
+    // Building nodes that are not in the graph keeps the cached order
+    size_t version = Node::get_topology_version();
+    auto neg = make_shared<op::Negative>(add);
+    EXPECT_EQ(Node::get_topology_version(), version);
+    EXPECT_EQ(f->get_ordered_ops(), ordered_ops);
+
+    // Rewiring an input is picked up
+    abs->input(0).replace_source_output(neg);
+    EXPECT_NE(Node::get_topology_version(), version);
+    EXPECT_EQ(f->get_ordered_ops().size(), 6u);
+    EXPECT_LT(position(neg), position(abs));
+
+    // So is replacing a node
+    auto mul = make_shared<op::Multiply>(a, b);
+    f->replace_node(add, mul);
+    EXPECT_EQ(position(add), static_cast<ptrdiff_t>(f->get_ordered_ops().size()));
+    EXPECT_LT(position(mul), position(neg));
+
+    // And adding a control dependency on a node outside the graph
+    auto sqrt = make_shared<op::Sqrt>(b);
+    neg->add_control_dependency(sqrt);
+    EXPECT_LT(position(sqrt), position(neg));
+    neg->remove_control_dependency(sqrt);
+    EXPECT_EQ(position(sqrt), static_cast<ptrdiff_t>(f->get_ordered_ops().size()));
+}
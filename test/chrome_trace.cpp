@@ -0,0 +1,207 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/chrome_trace.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t count_events(const string& path, const string& name)
+{
+    ifstream in(path);
+    stringstream ss;
+    ss << in.rdbuf();
+    string trace = ss.str();
+    EXPECT_EQ(trace.find("["), 0);
+    EXPECT_NE(trace.rfind("]"), string::npos);
+
+    string pattern = R"({"name":")" + name + R"(","cat":"test","ph":"X")";
+    size_t count = 0;
+    for (size_t pos = trace.find(pattern); pos != string::npos; pos = trace.find(pattern, pos + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+static void record_events(size_t count, const string& name)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        event::Duration d(name, "test");
+    }
+}
+
+TEST(chrome_trace, full)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::set_tracing_mode(event::Manager::Mode::Full);
+    event::Manager::open(path);
+    auto before = event::Manager::get_statistics();
+
+    thread t1(record_events, 1000, "full");
+    thread t2(record_events, 1000, "full");
+    record_events(1000, "full");
+    t1.join();
+    t2.join();
+    event::Manager::close();
+    event::Manager::set_tracing_mode(event::Manager::Mode::Disabled);
+
+    auto after = event::Manager::get_statistics();
+    EXPECT_EQ(after.recorded - before.recorded, 3000);
+    EXPECT_EQ(after.lost, before.lost);
+    EXPECT_EQ(count_events(path, "full"), 3000);
+    file_util::remove_file(path);
+}
+
+TEST(chrome_trace, sampled)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::set_tracing_mode(event::Manager::Mode::Sampled, 10);
+    event::Manager::open(path);
+    auto before = event::Manager::get_statistics();
+
+    thread t1(record_events, 1000, "sampled");
+    t1.join();
+    event::Manager::close();
+    event::Manager::set_tracing_mode(event::Manager::Mode::Disabled);
+
+    auto after = event::Manager::get_statistics();
+    EXPECT_EQ(after.recorded - before.recorded, 100);
+    EXPECT_EQ(after.skipped - before.skipped, 900);
+    EXPECT_EQ(count_events(path, "sampled"), 100);
+    file_util::remove_file(path);
+}
+
+TEST(chrome_trace, always_on)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::set_tracing_mode(event::Manager::Mode::AlwaysOn);
+    event::Manager::open(path);
+    auto before = event::Manager::get_statistics();
+
+    // More events than a ring buffer holds, only the latest ones are written
+    thread t1(record_events, 100000, "always_on");
+    t1.join();
+    event::Manager::close();
+    event::Manager::set_tracing_mode(event::Manager::Mode::Disabled);
+
+    auto after = event::Manager::get_statistics();
+    size_t written = after.written - before.written;
+    EXPECT_EQ(after.recorded - before.recorded, 100000);
+    EXPECT_EQ(written + after.lost - before.lost, 100000);
+    EXPECT_EQ(count_events(path, "always_on"), written);
+    file_util::remove_file(path);
+}
+
+TEST(chrome_trace, always_on_finished_threads)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::set_tracing_mode(event::Manager::Mode::AlwaysOn);
+    event::Manager::open(path);
+
+    // The events of finished threads outlive their buffers
+    for (size_t i = 0; i < 4; i++)
+    {
+        thread t(record_events, 10, "finished");
+        t.join();
+    }
+    event::Manager::close();
+    event::Manager::set_tracing_mode(event::Manager::Mode::Disabled);
+
+    EXPECT_EQ(count_events(path, "finished"), 40);
+    file_util::remove_file(path);
+}
+
+static string get_tid(const string& path, const string& event)
+{
+    ifstream in(path);
+    string line;
+    while (getline(in, line))
+    {
+        if (line.find(event) != string::npos)
+        {
+            size_t begin = line.find(R"("tid":)") + 6;
+            return line.substr(begin, line.find_first_of(",}", begin) - begin);
+        }
+    }
+    return "";
+}
+
+TEST(chrome_trace, thread_ids)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::set_tracing_mode(event::Manager::Mode::Full);
+    event::Manager::open(path);
+
+    thread t([]() {
+        event::Object object("tid_object", "");
+        {
+            event::Duration d("tid_duration", "test");
+        }
+        object.destroy();
+    });
+    t.join();
+    event::Manager::close();
+    event::Manager::set_tracing_mode(event::Manager::Mode::Disabled);
+
+    // Both kinds of events of a thread land on the same track
+    string tid = get_tid(path, R"("name":"tid_object","ph":"N")");
+    EXPECT_NE(tid, "");
+    EXPECT_EQ(get_tid(path, R"("name":"tid_duration")"), tid);
+    EXPECT_EQ(get_tid(path, R"("name":"tid_object","ph":"D")"), tid);
+    file_util::remove_file(path);
+}
+
+TEST(benchmark, chrome_trace)
+{
+    const size_t count = 100000;
+    auto measure = [count](event::Manager::Mode mode) {
+        event::Manager::set_tracing_mode(mode);
+        uint32_t name = event::Manager::intern("overhead");
+        uint32_t category = event::Manager::intern("test");
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++)
+        {
+            event::Duration d(name, category);
+        }
+        auto end = chrono::steady_clock::now();
+        event::Manager::set_tracing_mode(event::Manager::Mode::Disabled);
+        return chrono::duration_cast<chrono::nanoseconds>(end - start).count() /
+               static_cast<double>(count);
+    };
+
+    string path = file_util::tmp_filename(".json");
+    event::Manager::open(path);
+    double disabled = measure(event::Manager::Mode::Disabled);
+    double sampled = measure(event::Manager::Mode::Sampled);
+    double always_on = measure(event::Manager::Mode::AlwaysOn);
+    event::Manager::close();
+    file_util::remove_file(path);
+
+    NGRAPH_INFO << "Tracing overhead per event: disabled " << disabled << "ns, sampled "
+                << sampled << "ns, always on " << always_on << "ns";
+}
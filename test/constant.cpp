@@ -19,6 +19,8 @@
 #include <gtest/gtest.h>
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "ngraph/specialize_function.hpp"
 #include "util/type_prop.hpp"
 
 using namespace ngraph;
@@ -1022,6 +1024,73 @@ TEST(constant, shared_data)
     EXPECT_EQ(p1, p2);
 }
 
+namespace
+{
+    class WritableConstant : public op::Constant
+    {
+    public:
+        WritableConstant(const op::Constant& other)
+            : op::Constant(other)
+        {
+        }
+        float* data() { return static_cast<float*>(get_data_ptr_nc()); }
+    };
+}
+
+TEST(constant, shared_data_copy_on_write)
+{
+    auto c1 = make_shared<op::Constant>(element::f32, Shape{4}, vector<float>{1, 2, 3, 4});
+    WritableConstant c2(*c1);
+    EXPECT_EQ(c1->get_data_ptr(), c2.get_data_ptr());
+
+    // Writing detaches the writer, the other copy keeps its data
+    c2.data()[0] = 10;
+    EXPECT_NE(c1->get_data_ptr(), c2.get_data_ptr());
+    EXPECT_EQ(c1->get_vector<float>(), (vector<float>{1, 2, 3, 4}));
+    EXPECT_EQ(c2.get_vector<float>(), (vector<float>{10, 2, 3, 4}));
+
+    // A sole owner writes in place
+    const void* p2 = c2.get_data_ptr();
+    c2.data()[1] = 20;
+    EXPECT_EQ(c2.get_data_ptr(), p2);
+    EXPECT_EQ(c2.get_vector<float>(), (vector<float>{10, 20, 3, 4}));
+}
+
+TEST(constant, shared_buffer)
+{
+    auto values = make_shared<vector<float>>(vector<float>{1, 2, 3, 4});
+    auto buffer = make_shared<runtime::SharedBuffer<vector<float>>>(
+        reinterpret_cast<char*>(values->data()), values->size() * sizeof(float), values);
+
+    // A pointer to the derived buffer type selects the buffer constructor
+    op::Constant c(element::f32, Shape{4}, buffer);
+    EXPECT_EQ(c.get_data_ptr(), values->data());
+    EXPECT_EQ(c.get_vector<float>(), (vector<float>{1, 2, 3, 4}));
+}
+
+TEST(constant, clone_function_shares_data)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto weights = op::Constant::create(element::f32, Shape{3}, {1, 2, 3});
+    auto B = make_shared<op::Broadcast>(weights, Shape{2, 3}, AxisSet{0});
+    auto f = make_shared<Function>(make_shared<op::Multiply>(A, B), ParameterVector{A});
+
+    auto find_constant = [](const shared_ptr<Function>& function) {
+        for (auto node : function->get_ops())
+        {
+            if (auto constant = as_type_ptr<op::Constant>(node))
+            {
+                return constant;
+            }
+        }
+        return shared_ptr<op::Constant>();
+    };
+    EXPECT_EQ(find_constant(clone_function(*f))->get_data_ptr(), weights->get_data_ptr());
+    auto specialized = specialize_function(
+        f, {element::f32}, {PartialShape{2, 3}}, vector<void*>{nullptr});
+    EXPECT_EQ(find_constant(specialized)->get_data_ptr(), weights->get_data_ptr());
+}
+
 template <typename T1, typename T2>
 ::testing::AssertionResult test_convert()
 {
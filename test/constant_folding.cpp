@@ -19,6 +19,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/parallel_constant_folding.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -3068,3 +3069,134 @@ TEST(constant_folding, constant_scatter_elements_update_one_elem)
     expected.at(9) = 2;
     range_test_check(result_node->cast_vector<int32_t>(), expected);
 }
+
+static shared_ptr<Function> make_parallel_folding_function()
+{
+    Shape shape{3, 4};
+    vector<float> values(shape_size(shape));
+    iota(values.begin(), values.end(), -5.0f);
+    auto c0 = op::Constant::create(element::f32, shape, values);
+    auto c1 = op::Constant::create(element::f32, shape, vector<float>(values.size(), 0.5f));
+    auto c2 = op::Constant::create(element::f32, Shape{4, 3}, values);
+    auto param = make_shared<op::Parameter>(element::f32, shape);
+
+    // A tree of elementwise ops over Constants, evaluated in one sweep
+    auto tree = make_shared<op::Multiply>(
+        make_shared<op::Abs>(make_shared<op::Add>(c0, make_shared<op::Negative>(c1))), c1);
+    // Elementwise ops fed by a folded Reshape, and an intermediate used outside the subgraph
+    auto reshape = make_shared<op::Reshape>(c2, AxisVector{1, 0}, shape);
+    auto relu = make_shared<op::Relu>(make_shared<op::Subtract>(reshape, c0));
+    auto used_outside = make_shared<op::Add>(param, relu);
+    auto maximum = make_shared<op::Maximum>(relu, c1);
+    // An independent subgraph with an integer chain
+    auto i0 = op::Constant::create(element::i32, Shape{5}, {-2, -1, 0, 1, 2});
+    auto sign = make_shared<op::Sign>(make_shared<op::Negative>(i0));
+
+    return make_shared<Function>(NodeVector{tree, used_outside, maximum, sign},
+                                 ParameterVector{param});
+}
+
+TEST(constant_folding, parallel_matches_serial)
+{
+    auto expected = make_parallel_folding_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(expected);
+
+    for (size_t thread_count : {1, 4})
+    {
+        auto f = make_parallel_folding_function();
+        pass::ParallelConstantFolding folding(BuildNodeExecutorMap(), thread_count);
+        EXPECT_TRUE(folding.run_on_function(f));
+
+        // Only the Add that reads the parameter is left to compute
+        EXPECT_EQ(count_ops_of_type<op::Add>(f), 1);
+        EXPECT_EQ(count_ops_of_type<op::Constant>(f), 4);
+        EXPECT_EQ(folding.get_folded_node_count(), 10u);
+        EXPECT_EQ(folding.get_folded_byte_count(), (12 + 12 + 12) * sizeof(float) + 5 * 4u);
+
+        EXPECT_EQ(get_result_constant<float>(f, 0), get_result_constant<float>(expected, 0));
+        EXPECT_EQ(get_result_constant<float>(f, 2), get_result_constant<float>(expected, 2));
+        EXPECT_EQ(get_result_constant<int32_t>(f, 3), get_result_constant<int32_t>(expected, 3));
+        auto folded_relu = as_type_ptr<op::Constant>(
+            f->get_results().at(1)->get_argument(0)->get_argument(1));
+        auto expected_relu = as_type_ptr<op::Constant>(
+            expected->get_results().at(1)->get_argument(0)->get_argument(1));
+        ASSERT_TRUE(folded_relu && expected_relu);
+        EXPECT_EQ(folded_relu->get_vector<float>(), expected_relu->get_vector<float>());
+    }
+}
+
+TEST(constant_folding, parallel_partially_folded_subgraph)
+{
+    // The Abs folds but the Dot it feeds has no folder, so only the Abs is spliced back
+    auto make_function = []() {
+        auto c = op::Constant::create(element::f32, Shape{2, 2}, {-1, 2, -3, 4});
+        auto dot = make_shared<op::Dot>(make_shared<op::Abs>(c), c);
+        auto param = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+        return make_shared<Function>(make_shared<op::Add>(dot, param), ParameterVector{param});
+    };
+    auto expected = make_function();
+    pass::ConstantFolding().run_on_function(expected);
+    ASSERT_EQ(count_ops_of_type<op::Abs>(expected), 0);
+
+    for (size_t thread_count : {1, 2})
+    {
+        auto f = make_function();
+        pass::ParallelConstantFolding folding(BuildNodeExecutorMap(), thread_count);
+        EXPECT_TRUE(folding.run_on_function(f));
+
+        EXPECT_EQ(count_ops_of_type<op::Abs>(f), 0);
+        EXPECT_EQ(count_ops_of_type<op::Dot>(f), 1);
+        EXPECT_EQ(count_ops_of_type<op::Constant>(f), count_ops_of_type<op::Constant>(expected));
+        EXPECT_EQ(folding.get_folded_node_count(), 1u);
+        EXPECT_EQ(folding.get_folded_byte_count(), 4 * sizeof(float));
+
+        auto folded_abs = as_type_ptr<op::Constant>(
+            f->get_results().at(0)->get_argument(0)->get_argument(0)->get_argument(0));
+        auto expected_abs = as_type_ptr<op::Constant>(
+            expected->get_results().at(0)->get_argument(0)->get_argument(0)->get_argument(0));
+        ASSERT_TRUE(folded_abs && expected_abs);
+        EXPECT_EQ(folded_abs->get_vector<float>(), expected_abs->get_vector<float>());
+    }
+}
+
+TEST(constant_folding, parallel_rethrows)
+{
+    auto c = op::Constant::create(element::f32, Shape{2}, {-1, 4});
+    auto f = make_shared<Function>(make_shared<op::Sqrt>(c), ParameterVector{});
+    pass::ParallelConstantFolding folding;
+    EXPECT_THROW(folding.run_on_function(f), ngraph_error);
+}
+
+TEST(benchmark, parallel_constant_folding)
+{
+    // Independent subgraphs of large elementwise chains, as in imported weight preprocessing
+    Shape shape{256, 1024};
+    NodeVector results;
+    for (size_t i = 0; i < 16; ++i)
+    {
+        auto c = op::Constant::create(
+            element::f32, shape, vector<float>(shape_size(shape), static_cast<float>(i)));
+        shared_ptr<Node> node = c;
+        for (size_t j = 0; j < 8; ++j)
+        {
+            node = make_shared<op::Add>(make_shared<op::Negative>(node), c);
+        }
+        results.push_back(node);
+    }
+    auto serial = make_shared<Function>(results, ParameterVector{});
+    auto parallel = clone_function(*serial);
+
+    stopwatch timer;
+    timer.start();
+    pass::ConstantFolding().run_on_function(serial);
+    timer.stop();
+    cout << "ConstantFolding: " << timer.get_milliseconds() << "ms" << endl;
+
+    pass::ParallelConstantFolding folding;
+    folding.run_on_function(parallel);
+    cout << "ParallelConstantFolding: " << folding.get_folding_time_us() / 1000 << "ms, "
+         << folding.get_folded_node_count() << " nodes, " << folding.get_folded_byte_count()
+         << " bytes" << endl;
+}
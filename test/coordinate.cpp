@@ -20,6 +20,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
 #include "util/ndarray.hpp"
 #include "util/test_tools.hpp"
 
@@ -305,6 +306,76 @@ TEST(DISABLED_coordinate, dilation)
     EXPECT_TRUE(it == ct.end());
 }
 
+TEST(coordinate, strided_walk_collapse)
+{
+    // A dense copy collapses into a single run
+    Shape shape{2, 3, 4};
+    auto strides = StridedWalk::row_major_strides(shape);
+    StridedWalk dense(shape, strides, strides);
+    EXPECT_EQ(dense.get_outer_rank(), 0u);
+    EXPECT_EQ(dense.get_run_length(), 24u);
+
+    // Swapping the last two axes of {2, 3, 4} walks the input with a strided run
+    StridedWalk transpose(Shape{2, 4, 3}, {12, 1, 4}, {12, 3, 1});
+    EXPECT_EQ(transpose.get_outer_rank(), 2u);
+    EXPECT_EQ(transpose.get_run_length(), 3u);
+    EXPECT_EQ(transpose.get_src_run_stride(), 4);
+    EXPECT_EQ(transpose.get_dst_run_stride(), 1);
+
+    // Unit axes are dropped
+    StridedWalk unit(Shape{1, 5, 1}, {7, 1, 3}, {5, 1, 5});
+    EXPECT_EQ(unit.get_outer_rank(), 0u);
+    EXPECT_EQ(unit.get_run_length(), 5u);
+}
+
+TEST(coordinate, strided_walk_matches_coordinate_transform)
+{
+    // Slice with strides, walked both ways
+    Shape arg_shape{4, 5, 6};
+    Coordinate lower{1, 0, 1};
+    Coordinate upper{4, 5, 6};
+    Strides slice_strides{2, 1, 2};
+    CoordinateTransform ct(arg_shape, lower, upper, slice_strides);
+
+    auto arg_strides = StridedWalk::row_major_strides(arg_shape);
+    ptrdiff_t offset = 0;
+    for (size_t i = 0; i < arg_shape.size(); i++)
+    {
+        offset += lower[i] * arg_strides[i];
+        arg_strides[i] *= slice_strides[i];
+    }
+    Shape target_shape = ct.get_target_shape();
+    StridedWalk walk(
+        target_shape, arg_strides, StridedWalk::row_major_strides(target_shape), offset);
+
+    vector<size_t> expected;
+    for (const Coordinate& c : ct)
+    {
+        expected.push_back(ct.index(c));
+    }
+    vector<size_t> actual;
+    walk.for_each_run([&](ptrdiff_t src, ptrdiff_t dst) {
+        EXPECT_EQ(dst, static_cast<ptrdiff_t>(actual.size()));
+        for (size_t i = 0; i < walk.get_run_length(); i++)
+        {
+            actual.push_back(src + static_cast<ptrdiff_t>(i) * walk.get_src_run_stride());
+        }
+    });
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(coordinate, strided_walk_empty)
+{
+    StridedWalk walk(Shape{3, 0, 2}, {0, 2, 1}, {0, 2, 1});
+    size_t runs = 0;
+    walk.for_each_run([&](ptrdiff_t, ptrdiff_t) { runs++; });
+    EXPECT_EQ(runs, 0u);
+
+    StridedWalk scalar(Shape{}, {}, {});
+    scalar.for_each_run([&](ptrdiff_t, ptrdiff_t) { runs++; });
+    EXPECT_EQ(runs, 1u);
+}
+
 TEST(benchmark, coordinate)
 {
     Shape source_shape{128, 3, 2000, 1000};
@@ -335,3 +406,39 @@ TEST(benchmark, coordinate)
     timer.stop();
     cout << "time: " << timer.get_milliseconds() << endl;
 }
+
+TEST(benchmark, strided_walk_transpose)
+{
+    Shape in_shape{64, 32, 48, 40};
+    AxisVector axis_order{0, 3, 1, 2};
+    Shape out_shape{64, 40, 32, 48};
+    size_t element_count = shape_size(in_shape);
+    vector<float> in(element_count);
+    iota(in.begin(), in.end(), 0.0f);
+    vector<float> expected(element_count);
+    vector<float> actual(element_count);
+
+    // The CoordinateTransform walk reshape used to do
+    stopwatch timer;
+    timer.start();
+    CoordinateTransform input_transform(
+        in_shape, Coordinate(4, 0), in_shape, Strides(4, 1), axis_order);
+    CoordinateTransform output_transform(out_shape);
+    CoordinateTransform::Iterator output_it = output_transform.begin();
+    for (const Coordinate& input_coord : input_transform)
+    {
+        expected[output_transform.index(*output_it)] = in[input_transform.index(input_coord)];
+        ++output_it;
+    }
+    timer.stop();
+    double coordinate_ns = static_cast<double>(timer.get_nanoseconds()) / element_count;
+
+    timer.start();
+    runtime::reference::reshape(in.data(), actual.data(), in_shape, axis_order, out_shape);
+    timer.stop();
+    double walk_ns = static_cast<double>(timer.get_nanoseconds()) / element_count;
+
+    EXPECT_EQ(actual, expected);
+    cout << "CoordinateTransform: " << coordinate_ns << " ns/element" << endl;
+    cout << "StridedWalk:         " << walk_ns << " ns/element" << endl;
+}
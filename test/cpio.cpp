@@ -107,3 +107,28 @@ TEST(cpio, write)
         }
     }
 }
+
+TEST(cpio, write_aligned)
+{
+    const string test_file = "test2.cpio";
+    string s1 = "odd";
+    string s2 = "aligned";
+    {
+        cpio::Writer writer(test_file);
+        writer.write("a", s1.data(), static_cast<uint32_t>(s1.size()));
+        writer.write("b", s2.data(), static_cast<uint32_t>(s2.size()), 64);
+    }
+    {
+        cpio::Reader reader(test_file);
+        auto file_info = reader.get_file_info();
+        // The padding record in front of "b" is not listed
+        ASSERT_EQ(2u, file_info.size());
+        EXPECT_EQ(file_info[0].get_name(), "a");
+        EXPECT_EQ(file_info[1].get_name(), "b");
+        EXPECT_EQ(file_info[1].get_offset() % 64, 0u);
+
+        vector<char> data = reader.read(file_info[1]);
+        EXPECT_EQ(string(data.begin(), data.end()), s2);
+    }
+    file_util::remove_file(test_file);
+}
@@ -68,6 +68,7 @@
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
@@ -77,6 +78,7 @@
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
@@ -3942,3 +3944,82 @@ TEST(cpu_fusion, mlir_matmul_bias)
 }
 
 #endif
+
+TEST(cpu_fusion, MLIR_DISABLE_TEST(fuse_elementwise))
+{
+    Shape shape{4, 5, 300};
+    auto make_function = [shape]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{300});
+        auto scale = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto offset = make_shared<op::Parameter>(element::f32, Shape{});
+        auto select = make_shared<op::Parameter>(element::boolean, shape);
+        auto bias_broadcast = make_shared<op::Broadcast>(bias, shape, AxisSet{0, 1});
+        auto scale_broadcast = make_shared<op::Broadcast>(scale, shape, AxisSet{1, 2});
+        auto offset_broadcast = make_shared<op::Broadcast>(offset, shape, AxisSet{0, 1, 2});
+        // relu has two users, so it roots a tree of its own
+        auto product = make_shared<op::Multiply>(A, B);
+        auto relu = make_shared<op::Relu>(make_shared<op::Add>(product, bias_broadcast));
+        auto scaled = make_shared<op::Multiply>(make_shared<op::Exp>(relu), scale_broadcast);
+        auto shifted = make_shared<op::Subtract>(C, offset_broadcast);
+        auto out = make_shared<op::Tanh>(make_shared<op::Select>(select, scaled, shifted));
+        return make_shared<Function>(NodeVector{out, make_shared<op::Negative>(relu)},
+                                     ParameterVector{A, B, C, bias, scale, offset, select});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        if (param->get_element_type() == element::f32)
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+    }
+    vector<vector<char>> select_args{vector<char>(shape_size(shape))};
+    for (size_t i = 0; i < select_args[0].size(); i++)
+    {
+        select_args[0][i] = args[0][i] > 0;
+    }
+    auto int_results = execute<float, char, float>(int_f, args, select_args, "INTERPRETER");
+    set_environment("NGRAPH_PASS_ENABLES", "CPUElementwiseFusion:1", 1);
+    auto cpu_results = execute<float, char, float>(cpu_f, args, select_args, "CPU");
+    unset_environment("NGRAPH_PASS_ENABLES");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_f), 2);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(cpu_f), 0);
+}
+
+TEST(cpu_fusion, fuse_elementwise_control_dependencies)
+{
+    Shape shape{8};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto before = make_shared<op::Abs>(A);
+    auto product = make_shared<op::Multiply>(A, B);
+    auto out = make_shared<op::Exp>(make_shared<op::Add>(product, B));
+    auto after = make_shared<op::Negative>(B);
+    // Both links are on product, which is absorbed into the tree rooted at out
+    product->add_control_dependency(before);
+    after->add_control_dependency(product);
+    auto f = make_shared<Function>(NodeVector{out, before, after}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(f);
+
+    auto fused = as_type_ptr<op::FusedElementwise>(f->get_results().at(0)->get_argument(0));
+    ASSERT_NE(fused, nullptr);
+    EXPECT_EQ(fused->get_control_dependencies(), NodeVector{before});
+    ASSERT_EQ(after->get_control_dependencies(), NodeVector{fused});
+    EXPECT_TRUE(product->get_control_dependents().empty());
+}
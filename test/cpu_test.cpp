@@ -21,6 +21,10 @@
 #include <memory>
 #include <thread>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include "gtest/gtest.h"
 #include "misc.hpp"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -40,6 +44,9 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -1052,6 +1059,132 @@ TEST(cpu_test, thread_safe_calls_convolution_2d_2items)
     unset_environment("NGRAPH_CPU_CONCURRENCY");
 }
 
+TEST(cpu_test, thread_safe_calls_share_primitives)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    Shape shape{2, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto function = make_shared<Function>(make_shared<op::Relu>(A), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(function);
+
+    auto make_call = [&](float scale) {
+        vector<float> input(shape_size(shape));
+        vector<float> expected(shape_size(shape));
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = scale * (static_cast<float>(i) - 64.0f);
+            expected[i] = std::max(input[i], 0.0f);
+        }
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, input);
+        auto result = backend->create_tensor(element::f32, shape);
+
+        for (size_t i = 0; i < 10; i++)
+        {
+            handle->call_with_validate({result}, {a});
+            EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+        }
+    };
+
+    auto call_frame =
+        dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+
+    // Calls that do not overlap only need the first context, which builds the primitives
+    make_call(1.0f);
+    EXPECT_EQ(call_frame->get_num_contexts(), 1u);
+    vector<mkldnn::primitive*> published = call_frame->get_context_primitives(0);
+    EXPECT_TRUE(std::any_of(published.begin(), published.end(), [](mkldnn::primitive* p) {
+        return p != nullptr;
+    }));
+
+    // Contexts created for the concurrent calls reuse the published primitives
+    std::thread call1(make_call, 0.5f);
+    std::thread call2(make_call, 2.0f);
+    std::thread call3(make_call, -1.0f);
+    call1.join();
+    call2.join();
+    call3.join();
+    size_t num_contexts = call_frame->get_num_contexts();
+    EXPECT_GE(num_contexts, 1u);
+    EXPECT_LE(num_contexts, 2u);
+    for (size_t i = 0; i < num_contexts; i++)
+    {
+        EXPECT_EQ(call_frame->get_context_primitives(i), published);
+    }
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, MLIR_DISABLE_TEST(thread_safe_calls_share_weight_reorders))
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    Shape data_shape{1, 16, 8, 8};
+    Shape weights_shape{16, 16, 3, 3};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights_values(shape_size(weights_shape));
+    rng.initialize(weights_values);
+    auto make_function = [&]() {
+        auto data = make_shared<op::Parameter>(element::f32, data_shape);
+        auto weights = make_shared<op::Constant>(element::f32, weights_shape, weights_values);
+        auto conv = make_shared<op::Convolution>(data, weights, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(conv, ParameterVector{data});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_f = make_function();
+    auto handle = backend->compile(cpu_f);
+    // The weights are reordered at run time, and only the first context computes the reorder
+    ASSERT_GE(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 1);
+
+    vector<vector<float>> inputs(3, vector<float>(shape_size(data_shape)));
+    vector<vector<float>> expected;
+    for (auto& input : inputs)
+    {
+        rng.initialize(input);
+        auto results = execute(make_function(), vector<vector<float>>{input}, "INTERPRETER");
+        expected.push_back(results.at(0));
+    }
+
+    auto make_call = [&](size_t index) {
+        auto a = backend->create_tensor(element::f32, data_shape);
+        copy_data(a, inputs[index]);
+        auto result = backend->create_tensor(element::f32, cpu_f->get_output_shape(0));
+        for (size_t i = 0; i < 10; i++)
+        {
+            handle->call_with_validate({result}, {a});
+            EXPECT_TRUE(
+                test::all_close(expected[index], read_vector<float>(result), 1.0e-4f, 1.0e-4f));
+        }
+    };
+
+    std::thread call1(make_call, 0);
+    std::thread call2(make_call, 1);
+    std::thread call3(make_call, 2);
+    call1.join();
+    call2.join();
+    call3.join();
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
 // This test checks if a ConverLayout node is inserted before the ConvolutionBias node.
 // Since MLIR supports ConvolutionBias through callback, the data layout conversion is done in
 // callback.
@@ -2325,3 +2458,133 @@ TEST(cpu_test, one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+TEST(cpu_test, thread_pool_config)
+{
+    Shape shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    string error;
+    EXPECT_FALSE(backend->set_config({{"thread_pool", "dedicated"}}, error));
+    EXPECT_FALSE(backend->set_config({{"intra_op_threads", "zero"}}, error));
+    EXPECT_FALSE(backend->set_config({{"cpu_affinity", "3-1"}}, error));
+    EXPECT_FALSE(backend->set_config({{"wait_policy", "spin"}}, error));
+    EXPECT_FALSE(backend->set_config({{"cpu_affinity", "0"}, {"numa_node", "0"}}, error));
+    EXPECT_NE(error, "");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 1.0f));
+    copy_data(b, vector<float>(shape_size(shape), 2.0f));
+    vector<float> expected(shape_size(shape), 128.0f);
+
+    map<string, string> config{
+        {"thread_pool", "executable"}, {"intra_op_threads", "2"}, {"wait_policy", "sleep"}};
+    ASSERT_TRUE(backend->set_config(config, error)) << error;
+    auto pinned = backend->compile(f);
+    auto pinned_result = backend->create_tensor(element::f32, shape);
+    pinned->call_with_validate({pinned_result}, {a, b});
+    EXPECT_EQ(read_vector<float>(pinned_result), expected);
+
+    // The pool of the first executable is not shared with functions compiled later
+    ASSERT_TRUE(backend->set_config({{"thread_pool", "shared"}}, error)) << error;
+    auto shared = backend->compile(clone_function(*f));
+    auto shared_result = backend->create_tensor(element::f32, shape);
+    shared->call_with_validate({shared_result}, {a, b});
+    pinned->call_with_validate({pinned_result}, {a, b});
+    EXPECT_EQ(read_vector<float>(shared_result), expected);
+    EXPECT_EQ(read_vector<float>(pinned_result), expected);
+
+    // Every executable holds a pool, many live ones must not exhaust the executor
+    ASSERT_TRUE(backend->set_config({{"thread_pool", "executable"}}, error)) << error;
+    vector<shared_ptr<runtime::Executable>> handles;
+    for (size_t i = 0; i < 300; i++)
+    {
+        handles.push_back(backend->compile(clone_function(*f)));
+    }
+    handles.back()->call_with_validate({shared_result}, {a, b});
+    EXPECT_EQ(read_vector<float>(shared_result), expected);
+}
+
+TEST(cpu_test, thread_pool_config_reaches_executor)
+{
+    using runtime::cpu::executor::GetCPUExecutor;
+    using runtime::cpu::executor::WaitPolicy;
+    Shape shape{16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(A), ParameterVector{A});
+    auto backend = runtime::Backend::create("CPU");
+    string error;
+
+    // The shared scope runs on the process-wide pool
+    auto shared = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    EXPECT_EQ(shared->get_thread_pool(), nullptr);
+
+    // Without a size, executable pools default to one thread
+    ASSERT_TRUE(backend->set_config({{"thread_pool", "executable"}}, error)) << error;
+    auto single = static_pointer_cast<runtime::cpu::CPU_Executable>(
+        backend->compile(clone_function(*f)));
+    ASSERT_NE(single->get_thread_pool(), nullptr);
+    EXPECT_EQ(GetCPUExecutor().get_device(single->get_thread_pool()->get_arena()).numThreads(),
+              1);
+
+    map<string, string> config{{"thread_pool", "backend"},
+                               {"intra_op_threads", "2"},
+                               {"wait_policy", "sleep"}};
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+    int cpu = 0;
+    while (!CPU_ISSET(cpu, &allowed))
+    {
+        cpu++;
+    }
+    config["cpu_affinity"] = to_string(cpu);
+#endif
+    ASSERT_TRUE(backend->set_config(config, error)) << error;
+    auto first = static_pointer_cast<runtime::cpu::CPU_Executable>(
+        backend->compile(clone_function(*f)));
+    auto second = static_pointer_cast<runtime::cpu::CPU_Executable>(
+        backend->compile(clone_function(*f)));
+    auto pool = first->get_thread_pool();
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(second->get_thread_pool(), pool);
+    EXPECT_EQ(pool->get_config().num_threads, 2);
+    EXPECT_EQ(pool->get_config().wait_policy, WaitPolicy::Sleep);
+
+    auto& device = GetCPUExecutor().get_device(pool->get_arena());
+    EXPECT_EQ(device.numThreads(), 2);
+#if defined(__linux__)
+    EXPECT_EQ(pool->get_config().cpus, vector<int>{cpu});
+    // The pool threads only run on the configured cpu
+    cpu_set_t pinned;
+    CPU_ZERO(&pinned);
+    Eigen::Barrier barrier(1);
+    device.enqueue_with_barrier(&barrier, [&pinned]() {
+        sched_getaffinity(0, sizeof(pinned), &pinned);
+    });
+    barrier.Wait();
+    EXPECT_EQ(CPU_COUNT(&pinned), 1);
+    EXPECT_TRUE(CPU_ISSET(cpu, &pinned));
+#endif
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), -1.0f));
+    first->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 1.0f));
+}
+
+TEST(cpu_test, parse_cpu_list)
+{
+    using runtime::cpu::executor::parse_cpu_list;
+    EXPECT_EQ(parse_cpu_list("0-2, 5,7-7"), (vector<int>{0, 1, 2, 5, 7}));
+    EXPECT_EQ(parse_cpu_list(""), vector<int>{});
+    EXPECT_THROW(parse_cpu_list("2-1"), ngraph_error);
+    EXPECT_THROW(parse_cpu_list("0-1-2"), ngraph_error);
+    EXPECT_THROW(parse_cpu_list("a"), ngraph_error);
+}
@@ -90,6 +90,13 @@ TEST(file_util, path_join)
     }
 }
 
+TEST(file_util, get_directory)
+{
+    EXPECT_EQ(file_util::get_directory("/x1/x2/model.onnx"), "/x1/x2");
+    EXPECT_EQ(file_util::get_directory("x1/model.onnx"), "x1");
+    EXPECT_EQ(file_util::get_directory("model.onnx"), "");
+}
+
 TEST(file_util, get_temp_directory_path)
 {
     string tmp = file_util::get_temp_directory_path();
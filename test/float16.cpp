@@ -119,3 +119,47 @@ TEST(float16, values)
     EXPECT_EQ(static_cast<float16>(65519.0).to_bits(), 0x7bff);
     EXPECT_EQ(static_cast<float16>(65520.0).to_bits(), 0x7c00);
 }
+
+TEST(float16, bulk_conversions)
+{
+    vector<float16> halves;
+    for (uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+    {
+        if (!isnan(float16::from_bits(static_cast<uint16_t>(bits))))
+        {
+            halves.push_back(float16::from_bits(static_cast<uint16_t>(bits)));
+        }
+    }
+    vector<float> floats(halves.size());
+    float16::to_float(halves.data(), floats.data(), halves.size());
+    vector<float16> round_trip(halves.size());
+    float16::from_float(floats.data(), round_trip.data(), floats.size());
+    for (size_t i = 0; i < halves.size(); ++i)
+    {
+        ASSERT_EQ(floats[i], static_cast<float>(halves[i])) << halves[i].to_bits();
+        ASSERT_EQ(round_trip[i].to_bits(), halves[i].to_bits());
+    }
+
+    vector<float> values{5.960464477539063e-08f,
+                         2.9802322387695312e-08f,
+                         8.940696716308594e-08f,
+                         2.73786e-05f,
+                         -0.0223043f,
+                         65519.0f,
+                         65520.0f,
+                         1.0e-30f,
+                         numeric_limits<float>::infinity(),
+                         numeric_limits<float>::quiet_NaN()};
+    vector<float16> converted(values.size());
+    float16::from_float(values.data(), converted.data(), values.size());
+    EXPECT_EQ(converted[0].to_bits(), 0x01);
+    EXPECT_EQ(converted[1].to_bits(), 0x00);
+    EXPECT_EQ(converted[2].to_bits(), 0x02);
+    EXPECT_EQ(converted[3].to_bits(), 459);
+    EXPECT_EQ(converted[4].to_bits(), 42422);
+    EXPECT_EQ(converted[5].to_bits(), 0x7bff);
+    EXPECT_EQ(converted[6].to_bits(), 0x7c00);
+    EXPECT_EQ(converted[7].to_bits(), 0x00);
+    EXPECT_EQ(converted[8].to_bits(), 0x7c00);
+    EXPECT_TRUE(isnan(converted[9]));
+}
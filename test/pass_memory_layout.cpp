@@ -21,13 +21,16 @@
 
 #include "gtest/gtest.h"
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_scheduling.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/serializer.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -204,6 +207,50 @@ TEST(memory_manager, memory_align)
     EXPECT_EQ(128, mm.allocate(4));
 }
 
+TEST(memory_manager, greedy_by_size)
+{
+    pass::MemoryManager mm{1, pass::MemoryManager::allocation_scheme::GREEDY_BY_SIZE};
+
+    // a is live across everything, b and c are not live at the same time, d overlaps c
+    size_t a = mm.allocate(10);
+    size_t b = mm.allocate(40);
+    mm.free(b);
+    size_t c = mm.allocate(30);
+    size_t d = mm.allocate(20);
+    mm.free(c);
+    mm.free(d);
+    mm.plan();
+
+    EXPECT_EQ(mm.get_offset(b), 0);
+    EXPECT_EQ(mm.get_offset(c), 0);
+    EXPECT_EQ(mm.get_offset(a), 50);
+    EXPECT_EQ(mm.get_offset(d), 30);
+    EXPECT_EQ(mm.max_allocated(), 60);
+}
+
+TEST(memory_manager, greedy_by_size_fills_gaps)
+{
+    pass::MemoryManager mm{8, pass::MemoryManager::allocation_scheme::GREEDY_BY_SIZE};
+
+    // Online first fit puts the long lived c after the short lived b, so d has to go after c
+    // and the pool grows to 176 bytes
+    size_t a = mm.allocate(24);
+    size_t b = mm.allocate(64);
+    size_t c = mm.allocate(5);
+    mm.free(b);
+    size_t d = mm.allocate(80);
+    mm.free(a);
+    mm.free(c);
+    mm.free(d);
+    mm.plan();
+
+    EXPECT_EQ(mm.get_offset(d), 0);
+    EXPECT_EQ(mm.get_offset(b), 0);
+    EXPECT_EQ(mm.get_offset(a), 80);
+    EXPECT_EQ(mm.get_offset(c), 104);
+    EXPECT_EQ(mm.max_allocated(), 112);
+}
+
 TEST(memory_layout, basic)
 {
     pass::Manager pass_manager;
@@ -232,3 +279,124 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_scheduling, reduces_peak)
+{
+    // The default order computes the small negation of p1 first and keeps it alive across the
+    // large negation of p2 and its reduction
+    auto p1 = make_shared<op::Parameter>(element::f32, Shape{1024});
+    auto p2 = make_shared<op::Parameter>(element::f32, Shape{1024, 16});
+    auto small = make_shared<op::Negative>(p1);
+    auto large = make_shared<op::Negative>(p2);
+    auto sum = make_shared<op::Sum>(large, AxisSet{1});
+    auto f = make_shared<Function>(make_shared<op::Add>(small, sum), ParameterVector{p1, p2});
+
+    vector<shared_ptr<Node>> roots{f->get_results().at(0), p1, p2};
+    auto default_order = f->get_ordered_ops();
+    EXPECT_EQ(pass::MemoryScheduling::get_peak_live_bytes(default_order), (1 + 16 + 1) * 4096u);
+    EXPECT_EQ(pass::MemoryScheduling::get_peak_live_bytes(
+                  pass::MemoryScheduling::schedule(roots, 0)),
+              (1 + 16 + 1) * 4096u);
+    EXPECT_EQ(pass::MemoryScheduling::get_peak_live_bytes(
+                  pass::MemoryScheduling::schedule(roots, 24)),
+              (16 + 1) * 4096u);
+
+    pass::MemoryScheduling scheduling;
+    scheduling.run_on_function(f);
+    EXPECT_EQ(scheduling.get_pool_size_before(), (1 + 16 + 1) * 4096u);
+    EXPECT_EQ(scheduling.get_pool_size_after(), (16 + 1) * 4096u);
+    EXPECT_EQ(f->get_temporary_pool_size(), (16 + 1) * 4096u);
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops.size(), default_order.size());
+    auto position = [&](const shared_ptr<Node>& node) {
+        return find(ordered_ops.begin(), ordered_ops.end(), node) - ordered_ops.begin();
+    };
+    EXPECT_LT(position(sum), position(small));
+    for (auto& node : ordered_ops)
+    {
+        for (auto& input : node->inputs())
+        {
+            EXPECT_LT(position(input.get_source_output().get_node_shared_ptr()),
+                      position(node));
+        }
+    }
+}
+
+#ifndef NGRAPH_JSON_DISABLE
+// Checks that no two tensors live at the same time share memory and returns the largest
+// number of bytes live at once
+static size_t check_layout(const shared_ptr<Function>& f, size_t alignment)
+{
+    map<descriptor::Tensor*, pair<size_t, size_t>> live;
+    size_t live_bytes = 0;
+    size_t peak_live_bytes = 0;
+    for (auto& node : f->get_ordered_ops())
+    {
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            size_t begin = tensor->get_pool_offset();
+            size_t end = begin + pass::MemoryManager::align(tensor->size(), alignment);
+            EXPECT_LE(end, f->get_temporary_pool_size());
+            for (auto& other : live)
+            {
+                EXPECT_TRUE(end <= other.second.first || other.second.second <= begin)
+                    << tensor->get_name() << " overlaps " << other.first->get_name();
+            }
+            live[tensor] = {begin, end};
+            live_bytes += end - begin;
+        }
+        peak_live_bytes = max(peak_live_bytes, live_bytes);
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            auto it = live.find(tensor);
+            if (it != live.end())
+            {
+                live_bytes -= it->second.second - it->second.first;
+                live.erase(it);
+            }
+        }
+    }
+    return peak_live_bytes;
+}
+
+TEST(memory_layout, schemes_on_models)
+{
+    vector<string> models = {"mxnet/mnist_mlp_forward.json",
+                             "mxnet/10_bucket_LSTM.json",
+                             "mxnet/LSTM_forward.json",
+                             "mxnet/LSTM_backward.json",
+                             "mxnet/Seq2Seq_forward.json",
+                             "mxnet/Seq2Seq_backward.json",
+                             "mxnet/bn_fprop.json",
+                             "tf_conv_mnist_nhwc.json"};
+    const size_t alignment = 64;
+
+    for (const string& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        shared_ptr<Function> f = deserialize(file_util::read_file_to_string(json_path));
+
+        map<pass::MemoryManager::allocation_scheme, size_t> pool_sizes;
+        for (auto scheme : {pass::MemoryManager::allocation_scheme::FIRST_FIT,
+                            pass::MemoryManager::allocation_scheme::BEST_FIT,
+                            pass::MemoryManager::allocation_scheme::GREEDY_BY_SIZE})
+        {
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::Liveness>();
+            pass_manager.register_pass<pass::MemoryLayout>(alignment, false, scheme);
+            pass_manager.run_passes(f);
+
+            size_t pool_size = f->get_temporary_pool_size();
+            EXPECT_GE(pool_size, check_layout(f, alignment)) << model;
+            pool_sizes[scheme] = pool_size;
+        }
+        EXPECT_LE(pool_sizes[pass::MemoryManager::allocation_scheme::GREEDY_BY_SIZE],
+                  pool_sizes[pass::MemoryManager::allocation_scheme::FIRST_FIT])
+            << model;
+        EXPECT_LE(pool_sizes[pass::MemoryManager::allocation_scheme::GREEDY_BY_SIZE],
+                  pool_sizes[pass::MemoryManager::allocation_scheme::BEST_FIT])
+            << model;
+    }
+}
+#endif
@@ -760,3 +760,84 @@ TEST(pattern, is_contained_match)
     ASSERT_TRUE(n.match(label_abs2, absn2));
     ASSERT_FALSE(n.is_contained_match());
 }
+
+TEST(pattern, matcher_root_types)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+
+    auto add = make_shared<op::Add>(a, b);
+    auto add_types = make_shared<pattern::Matcher>(add)->get_root_types();
+    ASSERT_EQ(add_types.size(), 1u);
+    EXPECT_EQ(*add_types.begin(), op::Add::type_info);
+
+    auto label = make_shared<pattern::op::Label>(a);
+    EXPECT_TRUE(make_shared<pattern::Matcher>(label)->get_root_types().empty());
+
+    auto mul = make_shared<op::Multiply>(a, b);
+    auto add_or_mul = make_shared<pattern::op::Or>(OutputVector{add, mul});
+    auto or_types = make_shared<pattern::Matcher>(add_or_mul)->get_root_types();
+    EXPECT_EQ(or_types, (set<NodeTypeInfo>{op::Add::type_info, op::Multiply::type_info}));
+
+    auto add_or_label = make_shared<pattern::op::Or>(OutputVector{add, label});
+    EXPECT_TRUE(make_shared<pattern::Matcher>(add_or_label)->get_root_types().empty());
+
+    // Typed and untyped matchers must still run in registration order
+    auto graph = make_shared<op::Abs>(make_shared<op::Add>(a, b));
+    auto f = make_shared<Function>(graph, ParameterVector{a, b});
+    vector<string> calls;
+    pass::GraphRewrite rewrite;
+    auto record = [&calls](const string& name) {
+        return [&calls, name](pattern::Matcher& m) {
+            calls.push_back(name + ":" + m.get_match_root()->description());
+            return false;
+        };
+    };
+    rewrite.add_matcher(make_shared<pattern::Matcher>(make_shared<op::Abs>(label), "abs"),
+                        record("abs"));
+    rewrite.add_matcher(make_shared<pattern::Matcher>(label, "any"), record("any"));
+    rewrite.add_matcher(make_shared<pattern::Matcher>(add_or_mul, "add"), record("add"));
+    rewrite.run_on_function(f);
+    EXPECT_EQ(calls,
+              (vector<string>{"any:Parameter",
+                              "any:Parameter",
+                              "any:Add",
+                              "add:Add",
+                              "abs:Abs",
+                              "any:Abs",
+                              "any:Result"}));
+}
+
+TEST(benchmark, graph_rewrite_dispatch)
+{
+    // A long chain of elementwise ops rewritten by many matchers rooted at other op types
+    Shape shape{2, 2};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> node = a;
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        node = i % 2 ? static_pointer_cast<Node>(make_shared<op::Abs>(node))
+                     : static_pointer_cast<Node>(make_shared<op::Negative>(node));
+    }
+    auto f = make_shared<Function>(node, ParameterVector{a});
+
+    pass::GraphRewrite rewrite;
+    auto label = make_shared<pattern::op::Label>(element::f32, shape);
+    auto never = [](pattern::Matcher&) { return false; };
+    for (size_t i = 0; i < 25; ++i)
+    {
+        rewrite.add_matcher(make_shared<pattern::Matcher>(make_shared<op::Add>(label, label)),
+                            never);
+        rewrite.add_matcher(make_shared<pattern::Matcher>(make_shared<op::Multiply>(label, label)),
+                            never);
+        rewrite.add_matcher(make_shared<pattern::Matcher>(make_shared<op::Sqrt>(label)), never);
+        rewrite.add_matcher(make_shared<pattern::Matcher>(make_shared<op::Abs>(label)), never);
+    }
+
+    stopwatch timer;
+    timer.start();
+    rewrite.run_on_function(f);
+    timer.stop();
+    cout << "graph rewrite time: " << timer.get_milliseconds() << "ms" << endl;
+}
@@ -194,6 +194,52 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_cpio)
+{
+    const string tmp_file = "serialize_constant_cpio.cpio";
+    auto A = op::Constant::create(element::f32, Shape{3}, {1, 2, 3});
+    auto B = op::Constant::create(element::i8, Shape{}, {-5});
+    auto C = op::Constant::create(element::i64, Shape{2, 2}, {10, 20, 30, 40});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Add>(A, P), B, C},
+                                   ParameterVector{P});
+
+    serialize_to_cpio(tmp_file, f);
+    auto check = [](shared_ptr<Function> g) {
+        ASSERT_NE(g, nullptr);
+        size_t count = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            if (auto c = as_type_ptr<op::Constant>(node))
+            {
+                count++;
+                EXPECT_EQ(reinterpret_cast<size_t>(c->get_data_ptr()) % 64, 0u);
+                if (c->get_element_type() == element::f32)
+                {
+                    EXPECT_EQ((vector<float>{1, 2, 3}), c->get_vector<float>());
+                }
+                else if (c->get_element_type() == element::i8)
+                {
+                    EXPECT_EQ((vector<int8_t>{-5}), c->get_vector<int8_t>());
+                }
+                else
+                {
+                    EXPECT_EQ((vector<int64_t>{10, 20, 30, 40}), c->get_vector<int64_t>());
+                }
+            }
+        }
+        EXPECT_EQ(count, 3u);
+    };
+
+    // By path the archive is mapped; through a stream the records are read
+    check(deserialize(tmp_file));
+    {
+        ifstream in(tmp_file, ios_base::binary | ios_base::in);
+        check(deserialize(in));
+    }
+    file_util::remove_file(tmp_file);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(thread_pool, run_all_tasks)
+{
+    atomic<size_t> count{0};
+    {
+        runtime::ThreadPool pool(4);
+        EXPECT_EQ(pool.get_thread_count(), 4u);
+        EXPECT_EQ(pool.get_worker_index(), -1);
+        for (size_t i = 0; i < 1000; i++)
+        {
+            pool.submit([&count]() { count++; });
+        }
+        // The destructor finishes all queued tasks
+    }
+    EXPECT_EQ(count.load(), 1000u);
+}
+
+TEST(thread_pool, nested_submit)
+{
+    runtime::ThreadPool pool(3);
+    mutex m;
+    condition_variable cv;
+    atomic<size_t> remaining{100};
+    atomic<bool> worker_index_valid{true};
+    for (size_t i = 0; i < 50; i++)
+    {
+        pool.submit([&]() {
+            int index = pool.get_worker_index();
+            worker_index_valid = worker_index_valid && index >= 0 && index < 3;
+            // Tasks submitted from a worker go to that worker's queue and may be stolen
+            pool.submit([&]() {
+                lock_guard<mutex> lock(m);
+                if (--remaining == 0)
+                {
+                    cv.notify_all();
+                }
+            });
+            lock_guard<mutex> lock(m);
+            if (--remaining == 0)
+            {
+                cv.notify_all();
+            }
+        });
+    }
+    unique_lock<mutex> lock(m);
+    cv.wait(lock, [&]() { return remaining == 0; });
+    EXPECT_TRUE(worker_index_valid);
+}